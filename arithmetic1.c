@@ -0,0 +1,185 @@
+#include "shell.h"
+
+/**
+* arith_emit - function appends an instruction to the program.
+*
+* @parser: The parser.
+* @code: One of the ARITH_ constants.
+* @value: Number, jump target or offset of a variable name.
+* @length: Length of the variable name, 0 otherwise.
+*
+* Return: Index of the instruction, -1 if memory allocation fails.
+*/
+long arith_emit(ArithParser *parser, int code, long value, size_t length)
+{
+	ArithProgram *program = parser->program;
+	ArithOp *ops;
+	size_t capacity = program->capacity ? program->capacity * 2 : 16;
+
+	if (program->count == program->capacity)
+	{
+		ops = realloc_Memory(program->ops, sizeof(ArithOp) * program->capacity,
+							 sizeof(ArithOp) * capacity);
+		if (!ops)
+			return (parser->error = "out of memory", -1);
+		program->ops = ops;
+		program->capacity = capacity;
+	}
+	program->ops[program->count].code = code;
+	program->ops[program->count].value = value;
+	program->ops[program->count].length = length;
+	parser->lvalue = -1;
+	return (program->count++);
+}
+
+/**
+* arith_operator - function reads the infix operator at the parser
+* position, without consuming it.
+*
+* @parser: The parser.
+*
+* Return: The operator, or NULL if none follows.
+*/
+static const ArithOperator *arith_operator(ArithParser *parser)
+{
+	static const ArithOperator operators[] = {
+		{"<<=", ARITH_SHIFT_LEFT, 2}, {">>=", ARITH_SHIFT_RIGHT, 2},
+		{"**", ARITH_POWER, 14}, {"*=", ARITH_MULTIPLY, 2},
+		{"/=", ARITH_DIVIDE, 2}, {"%=", ARITH_MODULO, 2},
+		{"+=", ARITH_ADD, 2}, {"-=", ARITH_SUBTRACT, 2},
+		{"&=", ARITH_BIT_AND, 2}, {"^=", ARITH_BIT_XOR, 2},
+		{"|=", ARITH_BIT_OR, 2}, {"<<", ARITH_SHIFT_LEFT, 11},
+		{">>", ARITH_SHIFT_RIGHT, 11}, {"<=", ARITH_LESS_EQUAL, 10},
+		{">=", ARITH_GREATER_EQUAL, 10}, {"==", ARITH_EQUAL, 9},
+		{"!=", ARITH_NOT_EQUAL, 9}, {"&&", ARITH_AND, 5}, {"||", ARITH_OR, 4},
+		{"*", ARITH_MULTIPLY, 13}, {"/", ARITH_DIVIDE, 13},
+		{"%", ARITH_MODULO, 13}, {"+", ARITH_ADD, 12},
+		{"-", ARITH_SUBTRACT, 12}, {"<", ARITH_LESS, 10},
+		{">", ARITH_GREATER, 10}, {"&", ARITH_BIT_AND, 8},
+		{"^", ARITH_BIT_XOR, 7}, {"|", ARITH_BIT_OR, 6},
+		{"?", ARITH_JUMP_FALSE, 3}, {"=", ARITH_STORE, 2}, {",", ARITH_POP, 1},
+		{NULL, 0, 0}};
+	const ArithOperator *operator;
+	const char *text;
+	size_t i;
+
+	while (parser->position < parser->length &&
+		   IfInDelimiterSet(parser->text[parser->position], " \t\n"))
+		parser->position++;
+	text = parser->text + parser->position;
+	for (operator = operators; operator->text; operator++)
+	{
+		for (i = 0; operator->text[i] && text[i] == operator->text[i] &&
+			 parser->position + i < parser->length; i++)
+			;
+		if (!operator->text[i])
+			return (operator);
+	}
+	return (NULL);
+}
+
+/**
+* arith_assign - function parses the value of an assignment and stores it
+* into the variable just loaded.
+*
+* A plain '=' drops the load, the other assignments apply their operation
+* to the loaded value first.
+*
+* @parser: The parser, just past the operator.
+* @operator: The assignment operator.
+*
+* Return: 0 on success, -1 on error.
+*/
+static int arith_assign(ArithParser *parser, const ArithOperator *operator)
+{
+	ArithProgram *program = parser->program;
+	long load = parser->lvalue, name, length;
+
+	if (load == -1)
+		return (parser->error = "assignment to a non-variable", -1);
+	name = program->ops[load].value;
+	length = program->ops[load].length;
+	if (operator->code == ARITH_STORE)
+		program->count--;
+	if (arith_parse(parser, 2) == -1 || (operator->code != ARITH_STORE &&
+		arith_emit(parser, operator->code, 0, 0) == -1))
+		return (-1);
+	return (arith_emit(parser, ARITH_STORE, name, length) == -1 ? -1 : 0);
+}
+
+/**
+* arith_infix - function parses the right operand of an infix operator.
+*
+* Assignments store into the variable just loaded, "&&", "||" and "?:"
+* jump over the operand they do not evaluate, and ',' drops its left
+* operand.
+*
+* @parser: The parser, just past the operator.
+* @operator: The operator.
+*
+* Return: 0 on success, -1 on error.
+*/
+static int arith_infix(ArithParser *parser, const ArithOperator *operator)
+{
+	ArithProgram *program = parser->program;
+	long jump;
+
+	if (operator->precedence == 2)
+		return (arith_assign(parser, operator));
+	if (operator->code == ARITH_POP)
+		return (arith_emit(parser, ARITH_POP, 0, 0) == -1 ||
+				arith_parse(parser, 2) == -1 ? -1 : 0);
+	if (operator->code != ARITH_JUMP_FALSE && operator->code != ARITH_AND &&
+		operator->code != ARITH_OR)
+		return (arith_parse(parser, operator->precedence +
+							(operator->code != ARITH_POWER)) == -1 ||
+				arith_emit(parser, operator->code, 0, 0) == -1 ? -1 : 0);
+	jump = arith_emit(parser, operator->code, 0, 0);
+	if (jump == -1 || arith_parse(parser, operator->code == ARITH_JUMP_FALSE ?
+								   1 : operator->precedence + 1) == -1)
+		return (-1);
+	if (operator->code != ARITH_JUMP_FALSE)
+	{
+		if (arith_emit(parser, ARITH_BOOL, 0, 0) == -1)
+			return (-1);
+		program->ops[jump].value = program->count;
+		return (0);
+	}
+	if (parser->position >= parser->length ||
+		parser->text[parser->position++] != ':')
+		return (parser->error = "':' expected", -1);
+	program->ops[jump].value = program->count + 1;
+	jump = arith_emit(parser, ARITH_JUMP, 0, 0);
+	if (jump == -1 || arith_parse(parser, 3) == -1)
+		return (-1);
+	program->ops[jump].value = program->count;
+	return (parser->lvalue = -1, 0);
+}
+
+/**
+* arith_parse - function parses an expression by precedence climbing.
+*
+* An operand is parsed, then every infix operator binding at least as
+* tightly as @min is applied, its right operand parsed with the minimum
+* raised past the operator's own precedence (kept for right associative
+* ones), so the instructions come out in evaluation order.
+*
+* @parser: The parser.
+* @min: Lowest precedence of the operators to apply.
+*
+* Return: 0 on success, -1 on error, with the message in the parser.
+*/
+int arith_parse(ArithParser *parser, int min)
+{
+	const ArithOperator *operator;
+
+	if (arith_unary(parser) == -1)
+		return (-1);
+	while ((operator = arith_operator(parser)) && operator->precedence >= min)
+	{
+		parser->position += str_length((char *)operator->text);
+		if (arith_infix(parser, operator) == -1)
+			return (-1);
+	}
+	return (parser->error ? -1 : 0);
+}
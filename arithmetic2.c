@@ -0,0 +1,200 @@
+#include "shell.h"
+
+/**
+* arith_load - function gives the numeric value of a variable.
+*
+* An unset or empty variable is 0. A value that is not a plain integer is
+* evaluated as an expression in turn.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @value: Receives the value.
+*
+* Return: 0 on success, -1 if evaluating the value failed.
+*/
+static int arith_load(CommandInfo *information, const char *name,
+					  size_t length, long *value)
+{
+	const char *text = variable_get(information, name, length);
+	size_t size, sign, used;
+
+	*value = 0;
+	if (!text || !*text)
+		return (0);
+	size = str_length((char *)text);
+	sign = text[0] == '-' || text[0] == '+';
+	used = arith_number(text + sign, size - sign, value);
+	if (used && used + sign == size)
+	{
+		if (text[0] == '-')
+			*value = -(unsigned long)*value;
+		return (0);
+	}
+	return (arith_evaluate(information, text, size, value));
+}
+
+/**
+* arith_apply - function applies an operator to the top of the stack.
+*
+* Additions, subtractions and products wrap around instead of
+* overflowing.
+*
+* @code: ARITH_BOOL or one of the ARITH_ constants from ARITH_NEGATE on.
+* @stack: The evaluation stack.
+* @top: Number of values on the stack, updated.
+*
+* Return: NULL on success, the error message otherwise.
+*/
+static const char *arith_apply(int code, long *stack, size_t *top)
+{
+	long *a = &stack[*top - (code >= ARITH_MULTIPLY ? 2 : 1)], b, result;
+	unsigned long x = (unsigned long)*a, y;
+
+	if (code < ARITH_MULTIPLY)
+		return (*a = code == ARITH_BOOL ? x != 0 : code == ARITH_NOT ? !x :
+				code == ARITH_NEGATE ? (long)-x : (long)~x, NULL);
+	b = stack[--*top];
+	y = (unsigned long)b;
+	if ((code == ARITH_DIVIDE || code == ARITH_MODULO) && !b)
+		return ("division by 0");
+	if (code == ARITH_POWER && b < 0)
+		return ("exponent less than 0");
+	switch (code)
+	{
+	case ARITH_MULTIPLY: result = x * y; break;
+	case ARITH_DIVIDE: result = b == -1 ? (long)-x : *a / b; break;
+	case ARITH_MODULO: result = b == -1 ? 0 : *a % b; break;
+	case ARITH_ADD: result = x + y; break;
+	case ARITH_SUBTRACT: result = x - y; break;
+	case ARITH_SHIFT_LEFT: result = x << (y & 63); break;
+	case ARITH_SHIFT_RIGHT: result = *a >> (y & 63); break;
+	case ARITH_LESS: result = *a < b; break;
+	case ARITH_LESS_EQUAL: result = *a <= b; break;
+	case ARITH_GREATER: result = *a > b; break;
+	case ARITH_GREATER_EQUAL: result = *a >= b; break;
+	case ARITH_EQUAL: result = *a == b; break;
+	case ARITH_NOT_EQUAL: result = *a != b; break;
+	case ARITH_BIT_AND: result = *a & b; break;
+	case ARITH_BIT_XOR: result = *a ^ b; break;
+	case ARITH_BIT_OR: result = *a | b; break;
+	default:
+		for (b = 1; y; y >>= 1, x *= x)
+			if (y & 1)
+				b = (unsigned long)b * x;
+		result = b;
+	}
+	*a = result;
+	return (NULL);
+}
+
+/**
+* arith_jump - function runs an instruction that drops a value or changes
+* the instruction run next.
+*
+* @op: The instruction.
+* @stack: The evaluation stack.
+* @top: Number of values on @stack, updated.
+* @next: Index of the instruction, set to the one before the target of a
+* jump taken.
+*
+* Return: 1 if @op was one of those, 0 otherwise.
+*/
+static int arith_jump(ArithOp *op, long *stack, size_t *top, size_t *next)
+{
+	switch (op->code)
+	{
+	case ARITH_JUMP_FALSE:
+		if (stack[--*top])
+			return (1);
+	/* fall through */
+	case ARITH_JUMP:
+		*next = op->value - 1;
+		return (1);
+	case ARITH_AND:
+	case ARITH_OR:
+		if (!stack[*top - 1] != (op->code == ARITH_AND))
+			--*top;
+		else
+			stack[*top - 1] = op->code == ARITH_OR, *next = op->value - 1;
+		return (1);
+	case ARITH_POP:
+		--*top;
+		return (1);
+	}
+	return (0);
+}
+
+/**
+* arith_run - function evaluates a parsed expression.
+*
+* @information: Pointer to the command information structure.
+* @program: The parsed expression.
+* @result: Receives the value of the expression.
+* @error: Receives the error message, NULL when the error was already
+* reported by the evaluation of a variable.
+*
+* Return: 0 on success, -1 on error.
+*/
+int arith_run(CommandInfo *information, ArithProgram *program,
+			  long *result, const char **error)
+{
+	long *stack = program->stack;
+	size_t top = 0, i;
+	ArithOp *op;
+
+	for (i = 0; i < program->count; i++)
+	{
+		op = &program->ops[i];
+		if (arith_jump(op, stack, &top, &i))
+			continue;
+		if (op->code == ARITH_PUSH)
+			stack[top++] = op->value;
+		else if (op->code == ARITH_LOAD)
+		{
+			if (arith_load(information, program->text + op->value,
+						   op->length, &stack[top++]) == -1)
+				return (*error = NULL, -1);
+		}
+		else if (op->code == ARITH_STORE)
+			variable_set(information, program->text + op->value, op->length,
+						 conver_longInt_str(stack[top - 1], 10, 0));
+		else
+		{
+			*error = arith_apply(op->code, stack, &top);
+			if (*error)
+				return (-1);
+		}
+	}
+	*result = top ? stack[top - 1] : 0;
+	return (0);
+}
+
+/**
+* arith_command - function runs a "((expression))" command.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 1 if the command was one, 0 otherwise. The status is 0 when the
+* expression is non-zero, 1 when it is zero or fails.
+*/
+int arith_command(CommandInfo *information)
+{
+	char *word = information->arguments_array[0];
+	size_t length = str_length(word);
+	long value;
+
+	if (word[0] != '(' || word[1] != '(')
+		return (0);
+	information->current_line++;
+	if (information->argument_count != 1 || length < 4 ||
+		word[length - 1] != ')' || word[length - 2] != ')')
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "syntax error\n");
+		return (1);
+	}
+	if (arith_evaluate(information, word + 2, length - 4, &value) == 0)
+		information->execution_status = value == 0;
+	return (1);
+}
@@ -0,0 +1,158 @@
+#include "shell.h"
+
+/**
+* arith_release - function empties a cache slot.
+*
+* @program: The slot.
+*/
+static void arith_release(ArithProgram *program)
+{
+	free(program->text);
+	free(program->ops);
+	free(program->stack);
+	fillMemoryBlock((char *)program, 0, sizeof(ArithProgram));
+}
+
+/**
+* arith_parseInto - function parses an expression into an empty cache slot.
+*
+* @program: The slot, released first.
+* @text: The expression.
+* @length: Length of the expression.
+* @error: Receives the error message when parsing fails.
+*
+* Return: 0 on success, -1 on error, the slot left empty.
+*/
+static int arith_parseInto(ArithProgram *program, const char *text,
+						   size_t length, const char **error)
+{
+	ArithParser parser = {NULL, 0, 0, NULL, -1, NULL};
+
+	arith_release(program);
+	program->text = malloc(length + 1);
+	if (!program->text)
+		return (-1);
+	str_n_copy(program->text, (char *)text, length + 1);
+	program->length = length;
+	parser.text = program->text, parser.length = length;
+	parser.program = program;
+	if (arith_parse(&parser, 1) == -1 || parser.position < length)
+	{
+		*error = parser.error ? parser.error : "syntax error";
+		return (arith_release(program), -1);
+	}
+	program->stack = malloc(sizeof(long) * (program->count + 1));
+	if (!program->stack)
+		return (arith_release(program), -1);
+	return (0);
+}
+
+/**
+* arith_compile - function finds an expression in the cache, parsing it
+* into the least recently used slot if it is not there.
+*
+* @information: Pointer to the command information structure.
+* @text: The expression.
+* @length: Length of the expression.
+* @error: Receives the error message when parsing fails.
+*
+* Return: The parsed expression, NULL on error.
+*/
+static ArithProgram *arith_compile(CommandInfo *information, const char *text,
+								   size_t length, const char **error)
+{
+	ArithCache *cache = information->arithmetic;
+	ArithProgram *program, *slot = NULL;
+
+	*error = "out of memory";
+	if (!cache)
+	{
+		cache = malloc(sizeof(ArithCache));
+		if (!cache)
+			return (NULL);
+		fillMemoryBlock((char *)cache, 0, sizeof(ArithCache));
+		information->arithmetic = cache;
+	}
+	cache->clock++;
+	for (program = cache->programs; program < cache->programs +
+		 ARITH_CACHE_SIZE; program++)
+	{
+		if (program->text && program->length == length &&
+			!mem_compare(program->text, text, length))
+			return (shell_counters[COUNTER_ARITH_HITS]++,
+					program->used = cache->clock, program);
+		if (!program->active && (!slot || program->used < slot->used))
+			slot = program;
+	}
+	shell_counters[COUNTER_ARITH_MISSES]++;
+	if (!slot || arith_parseInto(slot, text, length, error) == -1)
+		return (NULL);
+	slot->used = cache->clock;
+	return (slot);
+}
+
+/**
+* arith_evaluate - function evaluates an arithmetic expression.
+*
+* The expression is parsed once and kept in a small cache keyed by its
+* text, so a counter updated on every line is evaluated without parsing
+* it again. Errors are reported on stderr and set the status to 1.
+*
+* @information: Pointer to the command information structure.
+* @text: The expression, parameters already expanded.
+* @length: Length of the expression.
+* @value: Receives the value; an empty expression is 0.
+*
+* Return: 0 on success, -1 on error.
+*/
+int arith_evaluate(CommandInfo *information, const char *text,
+				   size_t length, long *value)
+{
+	static int depth;
+	ArithProgram *program = NULL;
+	const char *error = "expression recursion level exceeded";
+	int result = -1;
+	size_t i;
+
+	for (i = 0; i < length && IfInDelimiterSet(text[i], " \t\n"); i++)
+		;
+	if (i == length)
+		return (*value = 0, 0);
+	if (depth < ARITH_DEPTH_MAX)
+		program = arith_compile(information, text, length, &error);
+	if (program)
+	{
+		depth++, program->active++;
+		result = arith_run(information, program, value, &error);
+		depth--, program->active--;
+	}
+	if (result == -1 && error)
+	{
+		printErrorMessage(information, "");
+		for (i = 0; i < length; i++)
+			error_print_char(text[i]);
+		error_print_str(": ");
+		error_print_str((char *)error);
+		error_print_char('\n');
+	}
+	if (result == -1)
+		information->execution_status = 1;
+	return (result);
+}
+
+/**
+* arith_free - function releases the cache of parsed expressions.
+*
+* @information: Pointer to the command information structure.
+*/
+void arith_free(CommandInfo *information)
+{
+	int i;
+
+	if (!information->arithmetic)
+		return;
+	for (i = 0; i < ARITH_CACHE_SIZE; i++)
+		arith_release(&information->arithmetic->programs[i]);
+	free(information->arithmetic);
+	information->arithmetic = NULL;
+}
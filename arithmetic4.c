@@ -0,0 +1,172 @@
+#include "shell.h"
+
+/**
+* arith_digit - function gives the value of a digit.
+*
+* @c: The digit.
+* @base: Base of the number, 2 to 64.
+*
+* Return: Value of the digit, or 64 if it is not one.
+*/
+static int arith_digit(char c, long base)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + (base <= 36 ? 10 : 36));
+	if (c == '@' || c == '_')
+		return (c == '@' ? 62 : 63);
+	return (64);
+}
+
+/**
+* arith_number - function reads an integer constant.
+*
+* Decimal, octal with a leading 0, hexadecimal with a leading 0x, and
+* "base#digits" for bases 2 to 64 are accepted.
+*
+* @text: The string.
+* @limit: Number of characters of @text that may be read.
+* @value: Receives the number.
+*
+* Return: Number of characters read, 0 if @text does not start with a
+* digit.
+*/
+size_t arith_number(const char *text, size_t limit, long *value)
+{
+	unsigned long number = 0;
+	size_t i = 0, base = 10;
+	int digit;
+
+	if (!limit || text[0] < '0' || text[0] > '9')
+		return (0);
+	if (limit > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+		base = 16, i = 2;
+	else if (text[0] == '0')
+		base = 8;
+	for (; i < limit && (digit = arith_digit(text[i], base)) < (int)base; i++)
+		number = number * base + digit;
+	if (base == 10 && i + 1 < limit && text[i] == '#' && number >= 2 &&
+		number <= 64)
+	{
+		base = number;
+		for (number = 0, i++; i < limit &&
+			 (digit = arith_digit(text[i], base)) < (int)base; i++)
+			number = number * base + digit;
+	}
+	*value = (long)number;
+	return (i);
+}
+
+/**
+* arith_prefix - function parses the operand of a prefix "++" or "--" and
+* stores it back changed by one.
+*
+* @parser: The parser, just past the operator.
+* @c: '+' or '-'.
+*
+* Return: 0 on success, -1 on error.
+*/
+static int arith_prefix(ArithParser *parser, char c)
+{
+	long load, name;
+	size_t length;
+
+	if (arith_unary(parser) == -1)
+		return (-1);
+	load = parser->lvalue;
+	if (load == -1)
+		return (parser->error = "assignment to a non-variable", -1);
+	name = parser->program->ops[load].value;
+	length = parser->program->ops[load].length;
+	arith_emit(parser, ARITH_PUSH, 1, 0);
+	arith_emit(parser, c == '+' ? ARITH_ADD : ARITH_SUBTRACT, 0, 0);
+	return (arith_emit(parser, ARITH_STORE, name, length) == -1 ? -1 : 0);
+}
+
+/**
+* arith_operand - function parses a number, or a variable with its postfix
+* "++" or "--".
+*
+* A variable after a postfix operator stores its value changed by one,
+* the value from before left on the stack.
+*
+* @parser: The parser.
+*
+* Return: 0 on success, -1 on error.
+*/
+static int arith_operand(ArithParser *parser)
+{
+	const char *text = parser->text;
+	size_t limit = parser->length, used;
+	long value, load;
+	char c;
+
+	used = arith_number(text + parser->position, limit - parser->position,
+						&value);
+	if (used)
+		return (parser->position += used,
+				arith_emit(parser, ARITH_PUSH, value, 0) == -1 ? -1 : 0);
+	used = variable_nameLength(text + parser->position,
+							   limit - parser->position);
+	if (!used)
+		return (parser->error = "operand expected", -1);
+	value = parser->position;
+	parser->position += used;
+	load = arith_emit(parser, ARITH_LOAD, value, used);
+	if (load == -1)
+		return (-1);
+	parser->lvalue = load;
+	c = parser->position + 1 < limit ? text[parser->position] : '\0';
+	if ((c != '+' && c != '-') || text[parser->position + 1] != c)
+		return (0);
+	parser->position += 2;
+	arith_emit(parser, ARITH_LOAD, value, used);
+	arith_emit(parser, ARITH_PUSH, 1, 0);
+	arith_emit(parser, c == '+' ? ARITH_ADD : ARITH_SUBTRACT, 0, 0);
+	arith_emit(parser, ARITH_STORE, value, used);
+	return (arith_emit(parser, ARITH_POP, 0, 0) == -1 ? -1 : 0);
+}
+
+/**
+* arith_unary - function parses an operand with its prefix and postfix
+* operators.
+*
+* @parser: The parser.
+*
+* Return: 0 on success, -1 on error.
+*/
+int arith_unary(ArithParser *parser)
+{
+	const char *text = parser->text;
+	size_t limit = parser->length;
+	char c;
+
+	while (parser->position < limit &&
+		   IfInDelimiterSet(text[parser->position], " \t\n"))
+		parser->position++;
+	c = parser->position < limit ? text[parser->position++] : '\0';
+	if ((c == '+' || c == '-') && parser->position < limit &&
+		text[parser->position] == c)
+		return (parser->position++, arith_prefix(parser, c));
+	if (c && char_in_str("+-!~", c))
+	{
+		if (arith_unary(parser) == -1)
+			return (-1);
+		return (c == '+' ? (parser->lvalue = -1, 0) : arith_emit(parser,
+			c == '-' ? ARITH_NEGATE : c == '!' ? ARITH_NOT : ARITH_COMPLEMENT,
+			0, 0) == -1 ? -1 : 0);
+	}
+	if (c == '(')
+	{
+		if (arith_parse(parser, 1) == -1)
+			return (-1);
+		if (parser->position >= limit || text[parser->position++] != ')')
+			return (parser->error = "missing ')'", -1);
+		return (parser->lvalue = -1, 0);
+	}
+	parser->position--;
+	return (arith_operand(parser));
+}
@@ -0,0 +1,173 @@
+#include "shell.h"
+
+/**
+* array_reserve - function makes the vector of an array hold @count slots.
+*
+* The vector doubles as it grows, and the new slots are cleared.
+*
+* @array: The array.
+* @count: Number of slots needed.
+* @associative: 1 for the entries of an associative array, 0 for the
+* values of an indexed one.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int array_reserve(ShellArray *array, size_t count, int associative)
+{
+	size_t capacity = array->capacity ? array->capacity : 8;
+	size_t slot = associative ? sizeof(ArrayEntry) : sizeof(char *);
+	char *slots;
+
+	if (count <= array->capacity)
+		return (0);
+	if (count > (unsigned int)-1 / slot / 2)
+		return (-1);
+	while (capacity < count)
+		capacity *= 2;
+	slots = realloc_Memory(associative ? (char *)array->entries :
+						   (char *)array->items, array->capacity * slot,
+						   capacity * slot);
+	if (!slots)
+		return (-1);
+	fillMemoryBlock(slots + array->capacity * slot, 0,
+					(capacity - array->capacity) * slot);
+	if (associative)
+		array->entries = (ArrayEntry *)slots;
+	else
+		array->items = (char **)slots;
+	array->capacity = capacity;
+	return (0);
+}
+
+/**
+* array_rehash - function doubles the number of buckets of an associative
+* array.
+*
+* @array: The array.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int array_rehash(ShellArray *array)
+{
+	size_t size = array->size ? array->size * 2 : VARIABLE_BUCKETS, i;
+	long *buckets = malloc(sizeof(long) * size);
+	ArrayEntry *entry;
+
+	if (!buckets)
+		return (-1);
+	for (i = 0; i < size; i++)
+		buckets[i] = -1;
+	for (i = 0; i < array->count; i++)
+	{
+		entry = &array->entries[i];
+		entry->next = buckets[entry->hash & (size - 1)];
+		buckets[entry->hash & (size - 1)] = i;
+	}
+	free(array->buckets);
+	array->buckets = buckets;
+	array->size = size;
+	return (0);
+}
+
+/**
+* array_findKey - function looks up a key of an associative array.
+*
+* @array: The array.
+* @key: The key, not NUL terminated.
+* @length: Length of the key.
+*
+* Return: Index of the entry, unset ones included, or -1 if there is none.
+*/
+long array_findKey(ShellArray *array, const char *key, size_t length)
+{
+	unsigned long hash;
+	size_t j;
+	long i;
+
+	if (!array->size)
+		return (-1);
+	hash = variable_hash(key, length);
+	for (i = array->buckets[hash & (array->size - 1)]; i != -1;
+		 i = array->entries[i].next)
+	{
+		if (array->entries[i].hash != hash)
+			continue;
+		for (j = 0; j < length && array->entries[i].key[j] == key[j]; j++)
+			;
+		if (j == length && !array->entries[i].key[j])
+			return (i);
+	}
+	return (-1);
+}
+
+/**
+* array_setIndex - function sets or unsets an element of an indexed array.
+*
+* @array: The array.
+* @index: The index.
+* @value: The new value, given to the array, or NULL to unset.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int array_setIndex(ShellArray *array, size_t index, char *value)
+{
+	if (!value)
+	{
+		if (index >= array->count)
+			return (0);
+		free(array->items[index]);
+		array->items[index] = NULL;
+		while (array->count && !array->items[array->count - 1])
+			array->count--;
+		return (0);
+	}
+	if (index + 1 < index || array_reserve(array, index + 1, 0) == -1)
+		return (free(value), -1);
+	free(array->items[index]);
+	array->items[index] = value;
+	if (index >= array->count)
+		array->count = index + 1;
+	return (0);
+}
+
+/**
+* array_setKey - function sets or unsets an element of an associative
+* array.
+*
+* An unset entry keeps its slot, so the order of the others and the
+* chains through their indexes stay as they are; setting the key again
+* revives it in place.
+*
+* @array: The array.
+* @key: The key, not NUL terminated.
+* @length: Length of the key.
+* @value: The new value, given to the array, or NULL to unset.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int array_setKey(ShellArray *array, const char *key, size_t length,
+				 char *value)
+{
+	long i = array_findKey(array, key, length);
+	ArrayEntry *entry;
+
+	if (i != -1 || !value)
+	{
+		if (i != -1)
+			free(array->entries[i].value), array->entries[i].value = value;
+		return (0);
+	}
+	if (array_reserve(array, array->count + 1, 1) == -1 ||
+		(array->count >= array->size && array_rehash(array) == -1))
+		return (free(value), -1);
+	entry = &array->entries[array->count];
+	entry->key = malloc(length + 1);
+	if (!entry->key)
+		return (free(value), -1);
+	str_n_copy(entry->key, (char *)key, length + 1);
+	entry->value = value;
+	entry->hash = variable_hash(key, length);
+	entry->next = array->buckets[entry->hash & (array->size - 1)];
+	array->buckets[entry->hash & (array->size - 1)] = array->count++;
+	return (0);
+}
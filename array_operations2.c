@@ -0,0 +1,157 @@
+#include "shell.h"
+
+/**
+* array_of - function gives the elements of a variable, turning it into an
+* array if it is a scalar.
+*
+* The value of a scalar becomes element 0, or key "0", keeping its buffer.
+*
+* @variable: The variable.
+* @associative: 1 to make an associative array, 0 for an indexed one.
+*
+* Return: The elements, or NULL if memory allocation fails.
+*/
+ShellArray *array_of(ShellVariable *variable, int associative)
+{
+	ShellArray *array = variable->array;
+
+	if (array)
+		return (array);
+	array = malloc(sizeof(ShellArray));
+	if (!array)
+		return (NULL);
+	fillMemoryBlock((char *)array, 0, sizeof(ShellArray));
+	variable->array = array;
+	variable->flags |= associative ? VARIABLE_ASSOCIATIVE : VARIABLE_ARRAY;
+	if (variable->value && associative)
+		array_setKey(array, "0", 1, variable->value);
+	else if (variable->value)
+		array_setIndex(array, 0, variable->value);
+	variable->value = NULL;
+	variable->capacity = 0;
+	return (array);
+}
+
+/**
+* array_clear - function frees the elements of an array, leaving the
+* variable an unset scalar.
+*
+* @variable: The variable.
+*/
+void array_clear(ShellVariable *variable)
+{
+	ShellArray *array = variable->array;
+	size_t i;
+
+	if (!array)
+		return;
+	for (i = 0; i < array->count; i++)
+	{
+		if (variable->flags & VARIABLE_ASSOCIATIVE)
+		{
+			free(array->entries[i].key);
+			free(array->entries[i].value);
+		}
+		else
+			free(array->items[i]);
+	}
+	free(array->items);
+	free(array->entries);
+	free(array->buckets);
+	free(array);
+	variable->array = NULL;
+	variable->flags &= ~(VARIABLE_ARRAY | VARIABLE_ASSOCIATIVE);
+}
+
+/**
+* array_key - function expands the subscript of an associative array.
+*
+* @information: Pointer to the command information structure.
+* @subscript: The subscript, between the brackets.
+* @length: Length of @subscript.
+*
+* Return: The key, to be freed, or NULL if memory allocation fails.
+*/
+char *array_key(CommandInfo *information, const char *subscript,
+				size_t length)
+{
+	StringBuilder key = {NULL, 0, 0};
+
+	expand_text(information, &key, subscript, length);
+	if (builder_reserve(&key, 0) == -1)
+		return (free(key.data), NULL);
+	return (key.data);
+}
+
+/**
+* array_index - function evaluates the subscript of an indexed array.
+*
+* The subscript is an arithmetic expression; a negative index counts from
+* the end of @variable.
+*
+* @information: Pointer to the command information structure.
+* @variable: The array, or NULL for a scalar.
+* @subscript: The subscript, between the brackets.
+* @length: Length of @subscript.
+* @index: Receives the index.
+*
+* Return: 0 on success, -1 after reporting it if the subscript is not a
+* valid index.
+*/
+int array_index(CommandInfo *information, ShellVariable *variable,
+				const char *subscript, size_t length, size_t *index)
+{
+	char *text = array_key(information, subscript, length);
+	long value;
+	int result;
+
+	if (!text)
+		return (-1);
+	result = arith_evaluate(information, text, str_length(text), &value);
+	if (result == 0 && value < 0)
+		value += variable && variable->array ? (long)variable->array->count : 1;
+	if (result == 0 && value < 0)
+	{
+		printErrorMessage(information, text);
+		error_print_str(": bad array subscript\n");
+		information->execution_status = 1;
+		result = -1;
+	}
+	free(text);
+	if (result == -1)
+		information->expansion_error = 1;
+	*index = result == 0 ? (size_t)value : 0;
+	return (result);
+}
+
+/**
+* array_element - function looks up an element of an array.
+*
+* @information: Pointer to the command information structure.
+* @variable: The array.
+* @subscript: The subscript, between the brackets.
+* @length: Length of @subscript.
+*
+* Return: The value, or NULL if the element is not set.
+*/
+const char *array_element(CommandInfo *information, ShellVariable *variable,
+						  const char *subscript, size_t length)
+{
+	ShellArray *array = variable->array;
+	size_t index;
+	char *key;
+	long i;
+
+	if (variable->flags & VARIABLE_ASSOCIATIVE)
+	{
+		key = array_key(information, subscript, length);
+		if (!key)
+			return (NULL);
+		i = array_findKey(array, key, str_length(key));
+		free(key);
+		return (i == -1 ? NULL : array->entries[i].value);
+	}
+	if (array_index(information, variable, subscript, length, &index) == -1)
+		return (NULL);
+	return (index < array->count ? array->items[index] : NULL);
+}
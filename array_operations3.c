@@ -0,0 +1,179 @@
+#include "shell.h"
+
+/**
+* array_concat - function builds the new value of an element.
+*
+* @old: The current value, NULL if the element is not set.
+* @value: The value assigned.
+* @append: 1 to append @value to @old.
+*
+* Return: The new value, to be freed, or NULL if memory allocation fails.
+*/
+static char *array_concat(const char *old, const char *value, int append)
+{
+	const char *head = append && old ? old : "";
+	char *element = malloc(str_length((char *)head) +
+						   str_length((char *)value) + 1);
+
+	if (!element)
+		return (NULL);
+	str_copy(element, (char *)head);
+	str_concatenate(element, (char *)value);
+	return (element);
+}
+
+/**
+* array_assign - function sets or unsets an element of a variable, making
+* it an array if it is a scalar.
+*
+* @information: Pointer to the command information structure.
+* @variable: The variable.
+* @subscript: The subscript, between the brackets.
+* @length: Length of @subscript.
+* @value: The value, or NULL to unset the element.
+* @append: 1 to append @value to the element ("a[i]+=value").
+*
+* Return: 0 on success, 1 if the variable is readonly, the subscript is
+* not valid or memory allocation fails.
+*/
+int array_assign(CommandInfo *information, ShellVariable *variable,
+				 const char *subscript, size_t length, const char *value,
+				 int append)
+{
+	int associative = (variable->flags & VARIABLE_ASSOCIATIVE) != 0, result;
+	char *key = NULL, *element = NULL;
+	const char *old = NULL;
+	ShellArray *array;
+	size_t index = 0;
+	long i = -1;
+
+	if (variable->flags & VARIABLE_READONLY)
+		return (variable_readonly(information, variable->name,
+								  variable->length), 1);
+	if (associative)
+		key = array_key(information, subscript, length);
+	if (associative ? !key : array_index(information, variable, subscript,
+										 length, &index) == -1)
+		return (1);
+	array = array_of(variable, associative);
+	if (array && associative)
+		i = array_findKey(array, key, str_length(key));
+	if (array)
+		old = associative ? (i == -1 ? NULL : array->entries[i].value) :
+			  (index < array->count ? array->items[index] : NULL);
+	if (array && value)
+		element = array_concat(old, value, append);
+	if (!array || (value && !element))
+		result = -1;
+	else
+		result = associative ? array_setKey(array, key, str_length(key),
+											element) :
+				 array_setIndex(array, index, element);
+	free(key);
+	return (result == -1);
+}
+
+/**
+* array_next - function walks the set elements of an array in order.
+*
+* @variable: The array.
+* @position: Slot to start from, moved past the element returned.
+* @keys: 1 to give the indexes or keys rather than the values.
+* @scratch: Buffer of 24 characters for an index.
+*
+* Return: The value or key, NULL past the last element.
+*/
+const char *array_next(ShellVariable *variable, size_t *position, int keys,
+					   char *scratch)
+{
+	ShellArray *array = variable->array;
+	size_t i;
+
+	while (array && *position < array->count)
+	{
+		i = (*position)++;
+		if (variable->flags & VARIABLE_ASSOCIATIVE)
+		{
+			if (array->entries[i].value)
+				return (keys ? array->entries[i].key :
+						array->entries[i].value);
+		}
+		else if (array->items[i])
+			return (keys ? str_copy(scratch, conver_longInt_str(i, 10, 0)) :
+					array->items[i]);
+	}
+	return (NULL);
+}
+
+/**
+* array_subscript - function measures the subscript after a name.
+*
+* @text: The string, just past the name.
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Length of the "[...]", brackets included, or 0 if @text does
+* not start with a complete one.
+*/
+size_t array_subscript(const char *text, size_t limit)
+{
+	size_t i, depth = 0;
+
+	for (i = 0; i < limit && text[i]; i++)
+	{
+		if (text[i] == '[')
+			depth++;
+		else if (!depth)
+			return (0);
+		else if (text[i] == ']' && !--depth)
+			return (i + 1);
+	}
+	return (0);
+}
+
+/**
+* array_lookup - function looks up "NAME[subscript]".
+*
+* "NAME[@]" and "NAME[*]" give the elements joined by spaces, in a buffer
+* reused by the next call. A scalar is an array of one element, 0.
+*
+* @information: Pointer to the command information structure.
+* @name: The name and its subscript, not NUL terminated.
+* @length: Length of @name.
+*
+* Return: The value, or NULL if it is not set.
+*/
+const char *array_lookup(CommandInfo *information, const char *name,
+						 size_t length)
+{
+	static StringBuilder joined;
+	size_t base = variable_nameLength(name, length), position = 0, index;
+	ShellVariable *variable = variable_find(information, name, base);
+	const char *value;
+	char scratch[24];
+	int first;
+
+	if (!array_all(name, length))
+	{
+		if (variable && variable->array)
+			return (array_element(information, variable, name + base + 1,
+								  length - base - 2));
+		if (array_index(information, NULL, name + base + 1, length - base - 2,
+						&index) == -1 || index)
+			return (NULL);
+		return (variable_get(information, name, base));
+	}
+	if (!variable || !variable->array)
+		return (variable_get(information, name, base));
+	joined.length = 0;
+	value = array_next(variable, &position, 0, scratch);
+	if (!value || builder_reserve(&joined, 0) == -1)
+		return (NULL);
+	for (first = 1; value; first = 0)
+	{
+		if (!first)
+			builder_appendChar(&joined, ' ');
+		builder_append(&joined, value, str_length((char *)value));
+		value = array_next(variable, &position, 0, scratch);
+	}
+	return (joined.data);
+}
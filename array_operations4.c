@@ -0,0 +1,132 @@
+#include "shell.h"
+
+/**
+* array_all - function tells whether a name stands for all the elements
+* of an array.
+*
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: Length of the name before "[@]" or "[*]", 0 if it is not one.
+*/
+size_t array_all(const char *name, size_t length)
+{
+	size_t base = variable_nameLength(name, length);
+
+	if (!base || length != base + 3 || name[base] != '[' ||
+		(name[base + 1] != '@' && name[base + 1] != '*') ||
+		name[base + 2] != ']')
+		return (0);
+	return (base);
+}
+
+/**
+* array_count - function counts the elements of "NAME[@]" for "${#...}".
+*
+* @information: Pointer to the command information structure.
+* @name: The name and its subscript, not NUL terminated.
+* @length: Length of @name.
+* @count: Receives the number of elements set.
+*
+* Return: 1 if @name stands for all the elements of an array, 0 if it is
+* to be measured as a value.
+*/
+int array_count(CommandInfo *information, const char *name, size_t length,
+				size_t *count)
+{
+	size_t base = array_all(name, length), position = 0;
+	ShellVariable *variable;
+	char scratch[24];
+
+	if (!base)
+		return (0);
+	variable = variable_find(information, name, base);
+	*count = 0;
+	if (variable && variable->array)
+		while (array_next(variable, &position, 0, scratch))
+			(*count)++;
+	else
+		*count = variable_get(information, name, base) != NULL;
+	return (1);
+}
+
+/**
+* array_expand - function appends all the elements, or all the keys, of
+* an array.
+*
+* The elements are separated by spaces, except for "NAME[@]" expanded at
+* the top level of a command word (@output is information->fields): they
+* are then separated by '\0', where variables_replacer splits the word
+* into one argument per element.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name and its subscript, not NUL terminated.
+* @length: Length of @name.
+* @keys: 1 for the indexes or keys ("${!NAME[@]}"), 0 for the values.
+*
+* Return: 1 if @name stands for all the elements of an array, 0 if it is
+* to be looked up as a value.
+*/
+int array_expand(CommandInfo *information, StringBuilder *output,
+				 const char *name, size_t length, int keys)
+{
+	size_t base = array_all(name, length), position = 0;
+	ShellVariable *variable;
+	const char *value;
+	char scratch[24], separator;
+	int first = 1;
+
+	if (!base)
+		return (0);
+	separator = information->fields == output && name[base + 1] == '@' ?
+				'\0' : ' ';
+	variable = variable_find(information, name, base);
+	if (!variable || !variable->array)
+	{
+		value = variable_get(information, name, base);
+		if (value)
+			builder_append(output, keys ? "0" : value,
+						   keys ? 1 : str_length((char *)value));
+		return (1);
+	}
+	while ((value = array_next(variable, &position, keys, scratch)))
+	{
+		if (!first)
+			builder_appendChar(output, separator);
+		builder_append(output, value, str_length((char *)value));
+		first = 0;
+	}
+	return (1);
+}
+
+/**
+* variable_unsetElement - function unsets "NAME[subscript]" for unset.
+*
+* @information: Pointer to the command information structure.
+* @word: The argument of unset.
+*
+* Return: 1 if @word names an element, 0 if it is to be unset as a
+* variable.
+*/
+int variable_unsetElement(CommandInfo *information, char *word)
+{
+	size_t size = str_length(word), length = variable_nameLength(word, size);
+	size_t subscript = array_subscript(word + length, size - length);
+	ShellVariable *variable;
+
+	if (!length || !subscript || length + subscript != size)
+		return (0);
+	variable = variable_find(information, word, length);
+	if (variable && variable->flags & VARIABLE_READONLY)
+	{
+		information->execution_status = 1;
+		printErrorMessage(information, word);
+		error_print_str(": cannot unset: readonly variable\n");
+	}
+	else if (variable && variable->array &&
+			 array_assign(information, variable, word + length + 1,
+						  subscript - 2, NULL, 0))
+		information->execution_status = 1;
+	return (1);
+}
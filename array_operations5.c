@@ -0,0 +1,179 @@
+#include "shell.h"
+
+/**
+* array_keyed - function assigns a "[subscript]=value" element of a
+* compound assignment.
+*
+* @information: Pointer to the command information structure.
+* @variable: The array.
+* @word: The element.
+* @subscript: Length of the "[subscript]" starting @word.
+* @next: Receives the index following the one assigned.
+*
+* Return: 0 on success, 1 on error.
+*/
+static int array_keyed(CommandInfo *information, ShellVariable *variable,
+					   const char *word, size_t subscript, size_t *next)
+{
+	StringBuilder value = {NULL, 0, 0};
+	int append = word[subscript] == '+', failed;
+	const char *key = word + 1, *text = word + subscript + 1 + append;
+	size_t length = subscript - 2, index;
+	char scratch[24];
+
+	if (!(variable->flags & VARIABLE_ASSOCIATIVE))
+	{
+		if (array_index(information, variable, key, length, &index) == -1)
+			return (1);
+		key = str_copy(scratch, conver_longInt_str(index, 10, 0));
+		length = str_length(scratch);
+		*next = index + 1;
+	}
+	expand_text(information, &value, text, str_length((char *)text));
+	failed = builder_reserve(&value, 0) == -1 ||
+			 array_assign(information, variable, key, length, value.data,
+						  append);
+	free(value.data);
+	return (failed);
+}
+
+/**
+* array_glob - function appends a field of a compound assignment to an
+* indexed array, as the paths it matches if it is a glob pattern that
+* matches any.
+*
+* @variable: The array.
+* @field: The field, expanded.
+* @next: Index of the element, moved past the elements appended.
+* @cache: Pointer to the directories listed so far.
+*
+* Return: 0 on success, 1 on error.
+*/
+static int array_glob(ShellVariable *variable, const char *field,
+					  size_t *next, GlobDirectory **cache)
+{
+	CompletionList matches = {NULL, 0, 0};
+	char *element;
+	size_t i;
+	int failed = 0;
+
+	if (!glob_isPattern(field, str_length((char *)field)) ||
+		glob_expand(cache, field, &matches) == 0)
+	{
+		element = str_duplicate(field);
+		return (!element || array_setIndex(variable->array, (*next)++,
+										   element));
+	}
+	glob_sort(&matches);
+	for (i = 0; i < matches.count; i++)
+	{
+		failed |= array_setIndex(variable->array, (*next)++,
+								 matches.names[i]) != 0;
+		matches.names[i] = NULL;
+	}
+	free(matches.names);
+	return (failed);
+}
+
+/**
+* array_fields - function appends the value of a plain element of a
+* compound assignment to an indexed array.
+*
+* "${b[@]}" in the element gives one element per element of b, and a
+* glob pattern one element per path it matches.
+*
+* @information: Pointer to the command information structure.
+* @variable: The array.
+* @word: The element.
+* @next: Index of the element, moved past the elements appended.
+*
+* Return: 0 on success, 1 on error.
+*/
+static int array_fields(CommandInfo *information, ShellVariable *variable,
+						const char *word, size_t *next)
+{
+	StringBuilder value = {NULL, 0, 0}, *saved = information->fields;
+	GlobDirectory *cache = NULL;
+	size_t start, i;
+	int failed = 0;
+
+	if (variable->flags & VARIABLE_ASSOCIATIVE)
+	{
+		printErrorMessage(information, (char *)word);
+		error_print_str(": must use subscript when assigning associative "
+						"array\n");
+		return (1);
+	}
+	information->fields = &value;
+	expand_text(information, &value, word, str_length((char *)word));
+	information->fields = saved;
+	if (builder_reserve(&value, 0) == -1)
+		return (1);
+	for (start = 0; start <= value.length; start = i + 1)
+	{
+		for (i = start; i < value.length && value.data[i]; i++)
+			;
+		failed |= array_glob(variable, value.data + start, next, &cache);
+	}
+	glob_forget(&cache);
+	free(value.data);
+	return (failed);
+}
+
+/**
+* array_compound - function runs a compound assignment
+* "NAME=(element ...)" or "NAME+=(element ...)".
+*
+* Elements are "value", given the index following the previous one, and
+* "[subscript]=value". Without '+' the array is emptied first; an
+* associative array stays one.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The "(...)", NUL terminated.
+* @append: 1 for "+=".
+*
+* Return: 0 on success, 1 on error.
+*/
+int array_compound(CommandInfo *information, const char *name,
+				   size_t length, const char *text, int append)
+{
+	ShellVariable *variable = variable_insert(information, name, length);
+	size_t size = str_length((char *)text), next = 0, subscript;
+	char *body, **words;
+	int failed = 0, i;
+
+	if (!variable)
+		return (1);
+	if (variable->flags & VARIABLE_READONLY)
+		return (variable_readonly(information, name, length), 1);
+	if (!append)
+	{
+		i = variable->flags & VARIABLE_ASSOCIATIVE;
+		array_clear(variable);
+		free(variable->value);
+		variable->value = NULL;
+		variable->capacity = 0;
+		variable->flags |= i;
+	}
+	body = malloc(size - 1);
+	if (!body || !array_of(variable, variable->flags & VARIABLE_ASSOCIATIVE))
+		return (free(body), 1);
+	next = variable->array->count;
+	str_n_copy(body, (char *)text + 1, size - 1);
+	words = syntax_split(body);
+	for (i = 0; words && words[i]; i++)
+	{
+		subscript = array_subscript(words[i], str_length(words[i]));
+		if (subscript && (words[i][subscript] == '=' ||
+			(words[i][subscript] == '+' && words[i][subscript + 1] == '=')))
+			failed |= array_keyed(information, variable, words[i], subscript,
+								  &next);
+		else
+			failed |= array_fields(information, variable, words[i], &next);
+	}
+	free(body);
+	freeStringArray(words);
+	return (failed);
+}
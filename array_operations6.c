@@ -0,0 +1,97 @@
+#include "shell.h"
+
+/**
+* array_each - function walks the values a pattern operator applies to,
+* every element for "NAME[@]" and "NAME[*]", the value itself otherwise.
+*
+* Before every element but the first, the separator array_expand would
+* put there is appended to @output.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer the results are appended to.
+* @name: The name, possibly with a subscript, not NUL terminated.
+* @length: Length of @name.
+* @position: 0 for the first value, moved past the value returned.
+* @scratch: Buffer of 24 characters for the numeric special parameters.
+*
+* Return: The next value, NULL past the last one.
+*/
+const char *array_each(CommandInfo *information, StringBuilder *output,
+					   const char *name, size_t length, size_t *position,
+					   char *scratch)
+{
+	size_t base = array_all(name, length), start = *position;
+	ShellVariable *variable = base ? variable_find(information, name, base) :
+							  NULL;
+	const char *value;
+
+	if (!variable || !variable->array)
+	{
+		if ((*position)++)
+			return (NULL);
+		return (base ? variable_get(information, name, base) :
+				expand_value(information, name, length, scratch));
+	}
+	value = array_next(variable, position, 0, scratch);
+	if (value && start)
+		builder_appendChar(output, information->fields == output &&
+						   name[base + 1] == '@' ? '\0' : ' ');
+	return (value);
+}
+
+/**
+* array_slice - function expands "${NAME[@]:offset}" and
+* "${NAME[@]:offset:count}", the elements from index @start on.
+*
+* A negative offset counts back from the end of the array; an
+* associative array is indexed by the order of its elements. A scalar is
+* cut as a value, as bash does.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name and its subscript, not NUL terminated.
+* @length: Length of @name.
+* @start: The offset.
+* @count: Most elements to expand, LONG_MAX for all.
+*
+* Return: 1 if @name stands for all the elements of an array variable, 0
+* if it is to be cut as a value.
+*/
+int array_slice(CommandInfo *information, StringBuilder *output,
+				const char *name, size_t length, long start, long count)
+{
+	size_t base = array_all(name, length), position = 0;
+	ShellVariable *variable = base ? variable_find(information, name, base) :
+							  NULL;
+	long total = 0, index = -1, done = 0;
+	const char *value;
+	char scratch[24];
+
+	if (!variable || !variable->array)
+		return (0);
+	if (count < 0)
+	{
+		printErrorMessage(information, "substring expression < 0\n");
+		information->expansion_error = 1;
+		return (1);
+	}
+	if (variable->flags & VARIABLE_ASSOCIATIVE)
+		while (array_next(variable, &position, 0, scratch))
+			total++;
+	else
+		total = variable->array->count;
+	start += start < 0 ? total : 0;
+	for (position = 0; start >= 0 && done < count &&
+		 (value = array_next(variable, &position, 0, scratch)); )
+	{
+		index = variable->flags & VARIABLE_ASSOCIATIVE ? index + 1 :
+				(long)position - 1;
+		if (index < start)
+			continue;
+		if (done++)
+			builder_appendChar(output, information->fields == output &&
+							   name[base + 1] == '@' ? '\0' : ' ');
+		builder_append(output, value, str_length((char *)value));
+	}
+	return (1);
+}
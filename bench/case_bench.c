@@ -0,0 +1,129 @@
+#include "../shell.h"
+#include <fnmatch.h>
+#include <time.h>
+
+/*
+* Built by "make bench", linking every unit but main.c.
+*/
+
+#define BENCH_ARMS 64
+#define BENCH_WORDS 200000
+
+/**
+* bench_now - function reads the monotonic clock.
+*
+* Return: The time in microseconds.
+*/
+static double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1e6 + now.tv_nsec / 1e3);
+}
+
+/**
+* bench_pattern - function makes up the pattern of an arm.
+*
+* Arms dispatch on file extensions, the way scripts do, with a few
+* bracket expressions and a catch-all last.
+*
+* @buffer: Buffer of at least 32 bytes receiving the pattern.
+* @arm: Index of the arm.
+*/
+static void bench_pattern(char *buffer, int arm)
+{
+	char *number = conver_longInt_str(arm, 10, 0);
+
+	if (arm == BENCH_ARMS - 1)
+		str_copy(buffer, "*");
+	else if (arm % 8 == 7)
+		str_copy(buffer, "[a-m]*.x"), str_concatenate(buffer, number);
+	else
+		str_copy(buffer, "*.e"), str_concatenate(buffer, number);
+}
+
+/**
+* bench_word - function makes up the word tested.
+*
+* @buffer: Buffer of at least 64 bytes receiving the word.
+* @seed: Number the word is derived from.
+*/
+static void bench_word(char *buffer, unsigned long seed)
+{
+	static const char * const names[] = {"main", "parser", "lexer",
+		"util", "README", "build", "notes", "zeta"};
+	char *number;
+
+	str_copy(buffer, "src/");
+	str_concatenate(buffer, (char *)names[seed % 8]);
+	str_concatenate(buffer, seed % 3 ? ".e" : ".x");
+	number = conver_longInt_str(seed * 2654435761UL % (BENCH_ARMS + 8), 10,
+								0);
+	str_concatenate(buffer, number);
+}
+
+/**
+* main - entry point of the case statement benchmark.
+*
+* Builds a case statement of BENCH_ARMS arms, then selects the arm of
+* BENCH_WORDS words with the compiled DFA, and with fnmatch called on
+* every pattern in turn as a naive case would.
+*
+* Return: 0 if both agree on every word, 1 otherwise.
+*/
+int main(void)
+{
+	CommandInfo information = COMMAND_INFO;
+	CaseProgram program;
+	char patterns[BENCH_ARMS][32], word[64], matched[BENCH_ARMS + 1];
+	StringBuilder text = {NULL, 0, 0};
+	unsigned long i, checksum[2] = {0, 0};
+	double start, elapsed[2];
+	int arm;
+
+	builder_append(&text, "case $w in", 10);
+	for (arm = 0; arm < BENCH_ARMS; arm++)
+	{
+		bench_pattern(patterns[arm], arm);
+		builder_append(&text, " ", 1);
+		builder_append(&text, patterns[arm], str_length(patterns[arm]));
+		builder_append(&text, ") ;;", 4);
+	}
+	builder_append(&text, " esac", 5);
+	fillMemoryBlock((char *)&program, 0, sizeof(CaseProgram));
+	start = bench_now();
+	if (case_compile(&information, &program, text.data, text.length) == -1)
+		return (1);
+	printf("compile %d arms: %.1f us\n", BENCH_ARMS, bench_now() - start);
+
+	start = bench_now();
+	for (i = 0; i < BENCH_WORDS; i++)
+	{
+		bench_word(word, i);
+		fillMemoryBlock(matched, 0, BENCH_ARMS);
+		case_match(&program, word, str_length(word), matched);
+		for (arm = 0; arm < BENCH_ARMS && !matched[arm]; arm++)
+			;
+		checksum[0] += arm;
+	}
+	elapsed[0] = bench_now() - start;
+
+	start = bench_now();
+	for (i = 0; i < BENCH_WORDS; i++)
+	{
+		bench_word(word, i);
+		for (arm = 0; arm < BENCH_ARMS && fnmatch(patterns[arm], word, 0); arm++)
+			;
+		checksum[1] += arm;
+	}
+	elapsed[1] = bench_now() - start;
+
+	printf("dfa:     %.3f us/word (%lu DFA states)\n", elapsed[0] / BENCH_WORDS,
+		   (unsigned long)program.count);
+	printf("fnmatch: %.3f us/word, %.1fx slower\n", elapsed[1] / BENCH_WORDS,
+		   elapsed[1] / elapsed[0]);
+	case_release(&program);
+	free(text.data);
+	return (checksum[0] != checksum[1]);
+}
@@ -0,0 +1,155 @@
+#include "../shell.h"
+#include <time.h>
+
+/*
+* Built by "make bench", linking every unit but main.c.
+*/
+
+#define BENCH_LAUNCHES 500
+#define BENCH_COMPONENT "directory_level_"
+
+/**
+* bench_now - function reads the monotonic clock.
+*
+* Return: The time in microseconds.
+*/
+static double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1e6 + now.tv_nsec / 1e3);
+}
+
+/**
+* bench_program - function copies /bin/true at the bottom of a chain of
+* directories.
+*
+* @path: Buffer of PATH_MAX bytes holding the top directory, receiving
+* the path of the copy.
+* @depth: Number of directories below the top one.
+*
+* Return: 0 on success, -1 on failure.
+*/
+static int bench_program(char *path, int depth)
+{
+	char buffer[65536];
+	int i, source, target;
+	ssize_t count;
+
+	for (i = 0; i < depth; i++)
+	{
+		str_concatenate(path, "/" BENCH_COMPONENT);
+		str_concatenate(path, conver_longInt_str(i, 10, 0));
+		if (mkdir(path, 0755) == -1 && errno != EEXIST)
+			return (-1);
+	}
+	str_concatenate(path, "/true");
+	source = open("/bin/true", O_RDONLY);
+	target = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0755);
+	while (source != -1 && target != -1 &&
+		   (count = read(source, buffer, sizeof(buffer))) > 0)
+		if (write(target, buffer, count) != count)
+			break;
+	if (source != -1)
+		close(source);
+	if (target != -1)
+		close(target);
+	return (source == -1 || target == -1 ? -1 : 0);
+}
+
+/**
+* bench_remove - function removes the directories and the copies.
+*
+* @top: The top directory.
+* @depth: Depth of the deepest copy.
+*/
+static void bench_remove(const char *top, int depth)
+{
+	char path[PATH_MAX];
+	int i, length;
+
+	for (; depth >= 0; depth--)
+	{
+		str_copy(path, (char *)top);
+		for (i = 0; i < depth; i++)
+		{
+			str_concatenate(path, "/" BENCH_COMPONENT);
+			str_concatenate(path, conver_longInt_str(i, 10, 0));
+		}
+		length = str_length(path);
+		str_concatenate(path, "/true");
+		unlink(path);
+		path[length] = '\0';
+		rmdir(path);
+	}
+}
+
+/**
+* bench_launches - function times the launches of a program the way the
+* shell runs an external command.
+*
+* @information: The command, found; its environment tells whether the
+* executable cache is used.
+*
+* Return: Microseconds per launch, or -1 if one failed.
+*/
+static double bench_launches(CommandInfo *information)
+{
+	double start = bench_now();
+	int i, failed = 0;
+
+	for (i = 0; i < BENCH_LAUNCHES; i++)
+	{
+		forkAndExecuteCommand(information);
+		failed |= information->execution_status != 0;
+	}
+	return (failed ? -1 : (bench_now() - start) / BENCH_LAUNCHES);
+}
+
+/**
+* main - entry point of the executable cache benchmark.
+*
+* Launches a copy of /bin/true kept deeper and deeper in a directory
+* tree, by its path and from the O_PATH descriptor of the cache.
+*
+* Return: 0 on success, 1 if a launch failed.
+*/
+int main(void)
+{
+	static const int depths[] = {1, 8, 32, 96};
+	CommandInfo plain[] = {COMMAND_INFO}, cached[] = {COMMAND_INFO};
+	char top[] = "/tmp/hsh_execXXXXXX", path[PATH_MAX], *arguments[2];
+	double direct, kept;
+	int failed = 0;
+	size_t i;
+
+	if (!mkdtemp(top))
+		return (1);
+	populateEnvironmentList(plain);
+	setenv("HSH_EXEC_CACHE", "1", 1);
+	populateEnvironmentList(cached);
+	printf("%d launches per depth\n", BENCH_LAUNCHES);
+	printf("%6s %14s %14s\n", "depth", "path (us)", "cached (us)");
+	for (i = 0; i < sizeof(depths) / sizeof(depths[0]); i++)
+	{
+		str_copy(path, top);
+		if (bench_program(path, depths[i]) == -1)
+			break;
+		arguments[0] = path, arguments[1] = NULL;
+		plain->executable_path = cached->executable_path = path;
+		plain->arguments_array = cached->arguments_array = arguments;
+		direct = bench_launches(plain);
+		kept = bench_launches(cached);
+		failed |= direct < 0 || kept < 0;
+		printf("%6d %14.1f %14.1f\n", depths[i], direct, kept);
+	}
+	printf("exec cache: %lu hits, %lu misses\n",
+		   shell_counters[COUNTER_EXEC_HITS],
+		   shell_counters[COUNTER_EXEC_MISSES]);
+	bench_remove(top, depths[sizeof(depths) / sizeof(depths[0]) - 1]);
+	plain->arguments_array = cached->arguments_array = NULL;
+	information_free(plain, 1);
+	information_free(cached, 1);
+	return (failed);
+}
@@ -0,0 +1,125 @@
+#include "../shell.h"
+#include <glob.h>
+#include <time.h>
+
+/*
+* Built by "make bench", linking every unit but main.c.
+*/
+
+#define BENCH_ENTRIES 100000
+#define BENCH_WORDS 3
+
+/**
+* bench_now - function reads the monotonic clock.
+*
+* Return: The time in microseconds.
+*/
+static double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1e6 + now.tv_nsec / 1e3);
+}
+
+/**
+* bench_name - function makes up the path of an entry.
+*
+* @buffer: Buffer of at least 64 bytes receiving the path.
+* @directory: The directory.
+* @seed: Number the entry is derived from.
+*/
+static void bench_name(char *buffer, const char *directory, unsigned long seed)
+{
+	static const char * const suffixes[] = {".c", ".h", ".o", ".txt"};
+
+	str_copy(buffer, (char *)directory);
+	str_concatenate(buffer, "/f");
+	str_concatenate(buffer, conver_longInt_str(seed * 2654435761UL % 1000003,
+											   10, 0));
+	str_concatenate(buffer, (char *)suffixes[seed % 4]);
+}
+
+/**
+* bench_words - function expands the words of one command line.
+*
+* @words: The patterns.
+* @shared: 1 to share the directory listings between the words, as a
+* command line does, 0 to read the directory for every word.
+*
+* Return: Number of paths matched.
+*/
+static size_t bench_words(char words[][64], int shared)
+{
+	CompletionList matches = {NULL, 0, 0};
+	GlobDirectory *cache = NULL;
+	size_t total = 0;
+	int i;
+
+	for (i = 0; i < BENCH_WORDS; i++)
+	{
+		glob_expand(&cache, words[i], &matches);
+		glob_sort(&matches);
+		total += matches.count;
+		completion_clear(&matches);
+		if (!shared)
+			glob_forget(&cache);
+	}
+	free(matches.names);
+	glob_forget(&cache);
+	return (total);
+}
+
+/**
+* main - entry point of the globbing benchmark.
+*
+* Fills a directory with BENCH_ENTRIES files, then expands a command line
+* of BENCH_WORDS patterns over it: with the listing shared by the words,
+* read again for every word, and with glob(3).
+*
+* Return: 0 if the three agree, 1 otherwise.
+*/
+int main(void)
+{
+	char directory[] = "/tmp/hsh_globXXXXXX", path[64], words[BENCH_WORDS][64];
+	static const char * const patterns[] = {"/*.c", "/*.h", "/f1*[0-4].o"};
+	size_t counts[3] = {0, 0, 0};
+	double start, elapsed[3];
+	unsigned long i;
+	glob_t found;
+	int descriptor;
+
+	if (!mkdtemp(directory))
+		return (1);
+	for (i = 0; i < BENCH_ENTRIES; i++)
+	{
+		bench_name(path, directory, i);
+		descriptor = open(path, O_CREAT | O_WRONLY, 0644);
+		if (descriptor != -1)
+			close(descriptor);
+	}
+	for (i = 0; i < BENCH_WORDS; i++)
+		str_copy(words[i], directory), str_concatenate(words[i],
+													   (char *)patterns[i]);
+	start = bench_now();
+	counts[0] = bench_words(words, 1);
+	elapsed[0] = bench_now() - start;
+	start = bench_now();
+	counts[1] = bench_words(words, 0);
+	elapsed[1] = bench_now() - start;
+	start = bench_now();
+	for (i = 0; i < BENCH_WORDS; i++)
+		if (glob(words[i], 0, NULL, &found) == 0)
+			counts[2] += found.gl_pathc, globfree(&found);
+	elapsed[2] = bench_now() - start;
+
+	printf("%d patterns over %d entries, %lu paths matched\n", BENCH_WORDS,
+		   BENCH_ENTRIES, (unsigned long)counts[0]);
+	printf("shared listing:   %.1f ms\n", elapsed[0] / 1e3);
+	printf("listing per word: %.1f ms\n", elapsed[1] / 1e3);
+	printf("glob(3):          %.1f ms\n", elapsed[2] / 1e3);
+	for (i = 0; i < BENCH_ENTRIES; i++)
+		bench_name(path, directory, i), unlink(path);
+	rmdir(directory);
+	return (counts[0] != counts[1] || counts[0] != counts[2]);
+}
@@ -0,0 +1,96 @@
+#include "../shell.h"
+#include <time.h>
+
+/*
+* Built by "make bench", linking every unit but main.c.
+*/
+
+#define BENCH_ENTRIES 100000
+#define BENCH_QUERIES 2000
+
+/**
+* bench_now - function reads the monotonic clock.
+*
+* Return: The time in microseconds.
+*/
+static double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1e6 + now.tv_nsec / 1e3);
+}
+
+/**
+* bench_entry - function makes up a history entry.
+*
+* @buffer: Buffer of at least 128 bytes receiving the entry.
+* @seed: Number the entry is derived from.
+*/
+static void bench_entry(char *buffer, unsigned long seed)
+{
+	static const char * const words[] = {"ls", "git", "grep", "make",
+		"cd", "cat", "ssh", "docker", "vim", "find"};
+	static const char * const args[] = {"-la", "status", "-rn", "install",
+		"src", "log", "--oneline", "build", "README.md", "-name"};
+	char *number;
+
+	buffer[0] = '\0';
+	str_concatenate(buffer, (char *)words[seed % 10]);
+	str_concatenate(buffer, " ");
+	str_concatenate(buffer, (char *)args[(seed / 10) % 10]);
+	str_concatenate(buffer, " ");
+	number = conver_longInt_str(seed * 2654435761UL % 1000003, 16, 0);
+	str_concatenate(buffer, number);
+}
+
+/**
+* main - entry point of the history search benchmark.
+*
+* Indexes BENCH_ENTRIES entries, then times substring searches (as done
+* by Ctrl-R) and prefix suggestions (as done while typing).
+*
+* Return: Always 0.
+*/
+int main(void)
+{
+	HistoryIndex *index = NULL;
+	char entry[128], query[128];
+	double start, elapsed;
+	unsigned long i, hits = 0;
+
+	start = bench_now();
+	for (i = 0; i < BENCH_ENTRIES; i++)
+	{
+		bench_entry(entry, i);
+		history_indexAdd(&index, entry);
+	}
+	elapsed = bench_now() - start;
+	printf("index %d entries: %.1f ms (%.2f us/entry)\n", BENCH_ENTRIES,
+		   elapsed / 1e3, elapsed / BENCH_ENTRIES);
+
+	start = bench_now();
+	for (i = 0; i < BENCH_QUERIES; i++)
+	{
+		bench_entry(entry, i * 7919 % BENCH_ENTRIES);
+		str_copy(query, entry + str_length(entry) - 4);
+		hits += history_indexSearch(index, query, -1, 0) != -1;
+	}
+	elapsed = bench_now() - start;
+	printf("search: %.2f us/query (%lu/%d found)\n", elapsed / BENCH_QUERIES,
+		   hits, BENCH_QUERIES);
+
+	hits = 0;
+	start = bench_now();
+	for (i = 0; i < BENCH_QUERIES; i++)
+	{
+		bench_entry(entry, i * 7919 % BENCH_ENTRIES);
+		entry[4 + i % 12] = '\0';
+		hits += history_indexSuggest(index, entry) != NULL;
+	}
+	elapsed = bench_now() - start;
+	printf("suggest: %.2f us/query (%lu/%d found)\n", elapsed / BENCH_QUERIES,
+		   hits, BENCH_QUERIES);
+	history_indexFree(&index);
+	return (0);
+}
@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+/*
+* End-to-end benchmark of shell binaries.
+*
+* Usage: bench/hsh_bench SHELL... (e.g. bench/hsh_bench ./hsh /bin/dash)
+*
+* Every shell runs the same generated scripts; the results are printed as
+* one JSON document on stdout, one object per shell, so runs can be kept
+* and compared between releases. Times are medians over the runs, RSS is
+* the peak over the runs, in KiB.
+*/
+
+#define BENCH_RUNS 9
+#define BENCH_ENV_VARS 2000
+#define BENCH_HISTORY 4096
+
+/**
+ * struct BenchCase - One scenario of the benchmark.
+ *
+ * @name: Name of the scenario in the results
+ * @line: Line the script repeats
+ * @lines: Number of lines of the script
+ * @commands: Commands run by the script, 0 to report the time only
+ * @large_env: 1 to run with BENCH_ENV_VARS extra environment variables
+ * @history: 1 to start with a full history file in HOME
+ */
+typedef struct BenchCase
+{
+	const char *name;
+	const char *line;
+	int lines;
+	int commands;
+	int large_env;
+	int history;
+} BenchCase;
+
+static const BenchCase bench_cases[] = {
+	{"startup", "exit 0", 1, 0, 0, 0},
+	{"builtin", "cd .", 10000, 10000, 0, 0},
+	{"external", "/bin/true", 500, 500, 0, 0},
+	{"chain", "cd . && cd . || cd /nonexistent", 5000, 10000, 0, 0},
+	{"large_env", "/bin/true", 200, 200, 1, 0},
+	{"large_history", "exit 0", 1, 0, 0, 1},
+	{NULL, NULL, 0, 0, 0, 0}
+};
+
+/**
+* bench_script - function writes a script repeating one line.
+*
+* @path: File to write.
+* @line: The line, without its newline.
+* @count: Number of times to repeat it.
+*
+* Return: 0 on success, -1 on failure.
+*/
+static int bench_script(const char *path, const char *line, int count)
+{
+	FILE *script = fopen(path, "w");
+	int i;
+
+	if (!script)
+		return (-1);
+	for (i = 0; i < count; i++)
+		fprintf(script, "%s\n", line);
+	return (fclose(script));
+}
+
+/**
+* bench_spawn - function runs a shell on a script once.
+*
+* @shell: Path of the shell.
+* @script: Path of the script.
+* @envp: Environment of the shell.
+* @rss: Updated with the peak RSS of the shell, in KiB.
+*
+* Return: Elapsed time in microseconds, or -1 on failure.
+*/
+static double bench_spawn(const char *shell, const char *script,
+						  char **envp, long *rss)
+{
+	struct timespec start, end;
+	struct rusage usage;
+	char *argv[3];
+	int status, null;
+	pid_t pid;
+
+	argv[0] = (char *)shell;
+	argv[1] = (char *)script;
+	argv[2] = NULL;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	pid = fork();
+	if (pid == 0)
+	{
+		null = open("/dev/null", O_RDWR);
+		dup2(null, 0);
+		dup2(null, 1);
+		dup2(null, 2);
+		execve(shell, argv, envp);
+		_exit(127);
+	}
+	if (pid == -1 || wait4(pid, &status, 0, &usage) == -1)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	if (usage.ru_maxrss > *rss)
+		*rss = usage.ru_maxrss;
+	return ((end.tv_sec - start.tv_sec) * 1e6 +
+			(end.tv_nsec - start.tv_nsec) / 1e3);
+}
+
+/**
+* bench_scenario - function times a scenario and prints its JSON object.
+*
+* The history file is reset before every run, since the shell saves its
+* history on exit and would otherwise start the next run with more.
+*
+* @shell: Path of the shell.
+* @scenario: The scenario.
+* @script: Path of the script.
+* @history: Path of the history file.
+* @envp: Environment of the shell.
+*/
+static void bench_scenario(const char *shell, const BenchCase *scenario,
+						   const char *script, const char *history,
+						   char **envp)
+{
+	double times[BENCH_RUNS], swap;
+	long rss = 0;
+	int i, j;
+
+	for (i = 0; i < BENCH_RUNS; i++)
+	{
+		unlink(history);
+		if (scenario->history)
+			bench_script(history, "echo a history entry", BENCH_HISTORY);
+		times[i] = bench_spawn(shell, script, envp, &rss);
+		for (j = i; j > 0 && times[j - 1] > times[j]; j--)
+		{
+			swap = times[j];
+			times[j] = times[j - 1];
+			times[j - 1] = swap;
+		}
+	}
+	printf("      \"%s\": {\"median_us\": %.1f, \"min_us\": %.1f, "
+		   "\"peak_rss_kib\": %ld", scenario->name, times[BENCH_RUNS / 2],
+		   times[0], rss);
+	if (scenario->commands)
+		printf(", \"commands_per_sec\": %.0f",
+			   scenario->commands / (times[BENCH_RUNS / 2] / 1e6));
+	printf("}");
+}
+
+/**
+* bench_environment - function builds the environments of the scenarios.
+*
+* @directory: Scratch directory, used as HOME.
+* @large: Receives an environment with BENCH_ENV_VARS extra variables.
+*
+* Return: The small environment: PATH and HOME only.
+*/
+static char **bench_environment(const char *directory, char ***large)
+{
+	static char home[4200], *small[3];
+	char **envp = malloc(sizeof(char *) * (BENCH_ENV_VARS + 3));
+	int i;
+
+	sprintf(home, "HOME=%s", directory);
+	small[0] = "PATH=/usr/local/bin:/usr/bin:/bin";
+	small[1] = home;
+	small[2] = NULL;
+	for (i = 0; envp && i < BENCH_ENV_VARS; i++)
+	{
+		envp[i] = malloc(128);
+		if (envp[i])
+			sprintf(envp[i], "BENCH_VARIABLE_%d=%0100d", i, i);
+	}
+	if (envp)
+	{
+		envp[i] = small[0];
+		envp[i + 1] = small[1];
+		envp[i + 2] = NULL;
+	}
+	*large = envp ? envp : small;
+	return (small);
+}
+
+/**
+* main - entry point of the shell benchmark.
+*
+* @argc: Number of arguments.
+* @argv: The shells to measure.
+*
+* Return: 0 on success, 1 on usage or setup error.
+*/
+int main(int argc, char **argv)
+{
+	char directory[] = "/tmp/hsh_bench.XXXXXX", path[4200], history[4200];
+	const BenchCase *scenario;
+	char **small, **large;
+	int i;
+
+	if (argc < 2 || !mkdtemp(directory))
+		return (fprintf(stderr, "usage: %s SHELL...\n", argv[0]), 1);
+	small = bench_environment(directory, &large);
+	sprintf(history, "%s/.simple_shell_history", directory);
+	sprintf(path, "%s/script", directory);
+	printf("{\n  \"runs\": %d,\n  \"shells\": [\n", BENCH_RUNS);
+	for (i = 1; i < argc; i++)
+	{
+		printf("    {\"shell\": \"%s\", \"results\": {", argv[i]);
+		for (scenario = bench_cases; scenario->name; scenario++)
+		{
+			bench_script(path, scenario->line, scenario->lines);
+			printf("%s\n", scenario == bench_cases ? "" : ",");
+			bench_scenario(argv[i], scenario, path, history,
+						   scenario->large_env ? large : small);
+		}
+		printf("\n    }}%s\n", i == argc - 1 ? "" : ",");
+	}
+	printf("  ]\n}\n");
+	unlink(history);
+	unlink(path);
+	rmdir(directory);
+	return (0);
+}
@@ -0,0 +1,207 @@
+#include "../shell.h"
+
+/*
+* Microbenchmarks of the string, tokenizer, list and environment helpers.
+* Built by "make bench", linking every unit but main.c, so the helpers are
+* measured exactly as the shell uses them, without any process spawning.
+* Throughput is the size of the input (the string, or the whole
+* environment list) divided by the time per call.
+*/
+
+#define BENCH_TIME 0.2	/* Seconds spent measuring each case */
+#define BENCH_ENV_ENTRIES 500
+
+#define OP_LENGTH 0
+#define OP_COMPARE 1
+#define OP_CHAR 2
+#define OP_PREFIX 3
+#define OP_DUPLICATE 4
+#define OP_TOKENIZE 5
+#define OP_FIND 6
+#define OP_GETENV 7
+#define OP_ARRAY 8
+
+/**
+ * struct BenchData - Input of a benchmark case.
+ *
+ * @text: String the helper works on
+ * @copy: Equal copy of @text, in its own buffer
+ * @last: Last character of @text
+ * @key: Environment variable looked up, with its '='
+ * @bytes: Bytes the helper goes through per call
+ * @information: Shell state holding the environment list
+ */
+typedef struct BenchData
+{
+	char *text;
+	char *copy;
+	char last;
+	char *key;
+	size_t bytes;
+	CommandInfo information;
+} BenchData;
+
+/**
+ * struct BenchCase - One benchmark case.
+ *
+ * @name: Name printed in the results
+ * @op: Helper called, one of the OP_ constants
+ * @input: 0 for a short token, 1 for a 4 KiB line, 2 for the environment
+ */
+typedef struct BenchCase
+{
+	const char *name;
+	int op;
+	int input;
+} BenchCase;
+
+static const BenchCase bench_cases[] = {
+	{"str_length", OP_LENGTH, 0}, {"str_length", OP_LENGTH, 1},
+	{"str_compare", OP_COMPARE, 0}, {"str_compare", OP_COMPARE, 1},
+	{"char_in_str", OP_CHAR, 0}, {"char_in_str", OP_CHAR, 1},
+	{"checkIfPrefix", OP_PREFIX, 0}, {"checkIfPrefix", OP_PREFIX, 1},
+	{"str_duplicate", OP_DUPLICATE, 0}, {"str_duplicate", OP_DUPLICATE, 1},
+	{"tokenizeString", OP_TOKENIZE, 0}, {"tokenizeString", OP_TOKENIZE, 1},
+	{"findNodeWithPrefix", OP_FIND, 2},
+	{"getEnvironmentVariable", OP_GETENV, 2},
+	{"convert_list_arrstr", OP_ARRAY, 2},
+	{NULL, 0, 0}
+};
+
+/**
+* bench_op - function calls the helper of a case once.
+*
+* @op: Helper to call, one of the OP_ constants.
+* @data: Input of the case.
+*
+* Return: A value derived from the result, so the call is not optimized
+* away.
+*/
+static long bench_op(int op, BenchData *data)
+{
+	StringList *list = data->information.environment_list;
+	char **array;
+	char *copy;
+	long result;
+
+	switch (op)
+	{
+	case OP_LENGTH:
+		return (str_length(data->text));
+	case OP_COMPARE:
+		return (str_compare(data->text, data->copy));
+	case OP_CHAR:
+		return ((long)char_in_str(data->text, data->last));
+	case OP_PREFIX:
+		return ((long)checkIfPrefix(data->text, data->copy));
+	case OP_DUPLICATE:
+		copy = str_duplicate(data->text);
+		result = copy != NULL;
+		free(copy);
+		return (result);
+	case OP_TOKENIZE:
+		array = tokenizeString(data->text, " ");
+		result = array != NULL;
+		freeStringArray(array);
+		return (result);
+	case OP_FIND:
+		return ((long)findNodeWithPrefix(list, data->key, -1));
+	case OP_GETENV:
+		return ((long)getEnvironmentVariable(&data->information, data->key));
+	default:
+		array = convert_list_arrstr(list);
+		result = array != NULL;
+		freeStringArray(array);
+		return (result);
+	}
+}
+
+/**
+* bench_measure - function times a case and prints its results.
+*
+* The number of calls is doubled until they take BENCH_TIME seconds.
+*
+* @scenario: The case.
+* @data: Input of the case.
+*/
+static void bench_measure(const BenchCase *scenario, BenchData *data)
+{
+	static const char * const inputs[] = {"short", "4KiB", "env500"};
+	struct timespec start, end;
+	unsigned long calls, i;
+	volatile long sink = 0;
+	double elapsed = 0;
+
+	for (calls = 16; elapsed < BENCH_TIME; calls *= 2)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (i = 0; i < calls; i++)
+			sink += bench_op(scenario->op, data);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		elapsed = (end.tv_sec - start.tv_sec) +
+				  (end.tv_nsec - start.tv_nsec) / 1e9;
+	}
+	calls /= 2;
+	printf("%-24s %-7s %12.1f ns/op %10.1f MB/s\n", scenario->name,
+		   inputs[scenario->input], elapsed * 1e9 / calls,
+		   data->bytes * (double)calls / elapsed / 1e6);
+	(void)sink;
+}
+
+/**
+* bench_prepare - function builds the input of one kind.
+*
+* @data: Receives the input.
+* @input: 0 for a short token, 1 for a 4 KiB line of words, 2 for an
+* environment of BENCH_ENV_ENTRIES variables, looked up by its last one.
+*/
+static void bench_prepare(BenchData *data, int input)
+{
+	static char line[4097], entry[64];
+	int i;
+
+	fillMemoryBlock((void *)data, 0, sizeof(BenchData));
+	for (i = 0; i < 4096; i++)
+		line[i] = i % 8 == 7 ? ' ' : 'a' + i % 26;
+	line[4095] = '!';
+	data->text = input ? line : "ls";
+	data->copy = str_duplicate(data->text);
+	data->last = data->text[str_length(data->text) - 1];
+	data->bytes = str_length(data->text);
+	if (input < 2)
+		return;
+	data->bytes = 0;
+	for (i = 0; i < BENCH_ENV_ENTRIES; i++)
+	{
+		str_copy(entry, "BENCH_VARIABLE_");
+		str_concatenate(entry, conver_longInt_str(i, 10, 0));
+		str_concatenate(entry, "=/usr/local/bin:/usr/bin:/bin");
+		addNodeToEndOfList(&data->information.environment_list, entry, 0);
+		data->bytes += str_length(entry) + 1;
+	}
+	data->key = "BENCH_VARIABLE_499=";
+}
+
+/**
+* main - entry point of the primitives benchmark.
+*
+* Return: Always 0.
+*/
+int main(void)
+{
+	BenchData data[3];
+	const BenchCase *scenario;
+	int i;
+
+	for (i = 0; i < 3; i++)
+		bench_prepare(&data[i], i);
+	printf("%-24s %-7s %18s %15s\n", "helper", "input", "time", "throughput");
+	for (scenario = bench_cases; scenario->name; scenario++)
+		bench_measure(scenario, &data[scenario->input]);
+	for (i = 0; i < 3; i++)
+	{
+		free(data[i].copy);
+		freeLinkedList(&data[i].information.environment_list);
+	}
+	return (0);
+}
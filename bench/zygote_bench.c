@@ -0,0 +1,114 @@
+#include "../shell.h"
+#include <time.h>
+
+/*
+* Built by "make bench", linking every unit but main.c.
+*/
+
+#define BENCH_LAUNCHES 200
+
+/**
+* bench_now - function reads the monotonic clock.
+*
+* Return: The time in microseconds.
+*/
+static double bench_now(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1e6 + now.tv_nsec / 1e3);
+}
+
+/**
+* bench_fork - function runs the command the way the shell does without a
+* zygote: fork, execve in the child, wait4 in the shell.
+*
+* @information: The command, found.
+*
+* Return: 0 if the command succeeded, 1 otherwise.
+*/
+static int bench_fork(CommandInfo *information)
+{
+	struct rusage usage;
+	pid_t child = fork();
+	int status = 1;
+
+	if (child == 0)
+	{
+		execve(information->executable_path, information->arguments_array,
+			   getEnvironmentVariables(information));
+		_exit(127);
+	}
+	if (child != -1)
+		wait4(child, &status, 0, &usage);
+	return (status != 0);
+}
+
+/**
+* bench_launches - function times the launches of a command.
+*
+* @information: The command, found.
+* @zygote: 1 to go through the zygote, 0 to fork the process.
+*
+* Return: Microseconds per launch, or -1 if one failed.
+*/
+static double bench_launches(CommandInfo *information, int zygote)
+{
+	double start = bench_now();
+	int i, failed = 0;
+
+	for (i = 0; i < BENCH_LAUNCHES; i++)
+	{
+		if (zygote)
+			failed |= zygote_launch(information) == -1 ||
+				information->execution_status != 0;
+		else
+			failed |= bench_fork(information);
+	}
+	return (failed ? -1 : (bench_now() - start) / BENCH_LAUNCHES);
+}
+
+/**
+* main - entry point of the zygote benchmark.
+*
+* Starts the zygote while the process is small, then grows the process
+* step by step, touching every page, and times /bin/true launched by a
+* fork of the process and by the zygote at every size.
+*
+* Return: 0 on success, 1 if a launch failed.
+*/
+int main(void)
+{
+	static const size_t sizes[] = {0, 64, 256, 1024};
+	CommandInfo information[] = {COMMAND_INFO};
+	char *arguments[] = {"/bin/true", NULL}, *ballast = NULL, *grown;
+	double direct, zygote;
+	int failed = 0;
+	size_t i;
+
+	setenv("HSH_ZYGOTE", "1", 1);
+	populateEnvironmentList(information);
+	zygote_start(information);
+	information->executable_path = arguments[0];
+	information->arguments_array = arguments;
+	printf("%d launches of /bin/true per size\n", BENCH_LAUNCHES);
+	printf("%10s %14s %14s\n", "RSS (MiB)", "fork (us)", "zygote (us)");
+	for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+	{
+		grown = sizes[i] ? realloc(ballast, sizes[i] << 20) : ballast;
+		if (sizes[i] && !grown)
+			break;
+		ballast = grown;
+		if (sizes[i])
+			fillMemoryBlock(ballast, 1, sizes[i] << 20);
+		direct = bench_launches(information, 0);
+		zygote = bench_launches(information, 1);
+		failed |= direct < 0 || zygote < 0;
+		printf("%10lu %14.1f %14.1f\n", (unsigned long)sizes[i], direct, zygote);
+	}
+	free(ballast);
+	information->arguments_array = NULL;
+	information_free(information, 1);
+	return (failed);
+}
@@ -1,9 +1,15 @@
 #include "shell.h"
+
+static char read_buffer[BUFFER_RD], *command_chain_buffer;
+static size_t buffer_index, read_buffer_size;
+static size_t current_position, chain_start_position, buffer_length;
+
 /**
 * custom_getline - function custom implementation of getline.
 *
 * This function reads a line from the input and stores it in the provided
-* buffer, reallocating memory as needed.
+* buffer, reallocating memory as needed. A line longer than what is left
+* in the read buffer is completed with further reads.
 *
 * @information: A pointer to the CommandInfo structure
 * containing command information.
@@ -15,102 +21,38 @@
 ssize_t custom_getline(CommandInfo *information,
 					   char **buffer, size_t *buffer_size)
 {
-	static char read_buffer[BUFFER_RD];
-
-	static size_t buffer_index, read_buffer_size;
-	size_t characters_read;
-	ssize_t read_result = 0, temp = 0;
-	char *current_buffer = NULL, *new_buffer = NULL, *newline_position;
-
-	current_buffer = *buffer;
-	if (current_buffer && buffer_size)
-		temp = *buffer_size;
-	if (buffer_index == read_buffer_size)
-		buffer_index = read_buffer_size = 0;
-
-	read_result = read_input_buffer(information, read_buffer, &read_buffer_size);
-	if (read_result == -1 || (read_result == 0 && read_buffer_size == 0))
-		return (-1);
-
-	newline_position = char_in_str(read_buffer + buffer_index, '\n');
-	characters_read = newline_position ?
-									1 + (unsigned int)(newline_position - read_buffer) : read_buffer_size;
-	new_buffer = realloc_Memory
-			(current_buffer, temp, temp ? temp + characters_read : characters_read + 1);
-	if (!new_buffer)
-		return (current_buffer ? free(current_buffer), -1 : -1);
-
-	if (temp)
-		str_n_concatenate
-						(new_buffer, read_buffer + buffer_index, characters_read - buffer_index);
-	else
-		str_n_copy
-		(new_buffer, read_buffer + buffer_index, characters_read - buffer_index + 1);
-
-	temp += characters_read - buffer_index;
-	buffer_index = characters_read;
-	current_buffer = new_buffer;
+	size_t end, length = 0;
+	ssize_t read_result;
+	char *line = *buffer, *new_buffer;
+
+	do {
+		/* Step 1: Refill the read buffer once it is used up */
+		if (buffer_index == read_buffer_size)
+			buffer_index = read_buffer_size = 0;
+		read_result = read_input_buffer(information, read_buffer,
+										&read_buffer_size);
+		if (read_result == -1 || (read_result == 0 && !read_buffer_size))
+			break;
+
+		/* Step 2: Append up to and including the next newline */
+		for (end = buffer_index; end < read_buffer_size &&
+			 read_buffer[end] != '\n'; end++)
+			;
+		end += end < read_buffer_size;
+		new_buffer = realloc_Memory(line, length,
+									length + end - buffer_index + 1);
+		if (!new_buffer)
+			return (free(line), *buffer = NULL, -1);
+		line = new_buffer;
+		while (buffer_index < end)
+			line[length++] = read_buffer[buffer_index++];
+		line[length] = '\0';
+	} while (line[length - 1] != '\n');
 
 	if (buffer_size)
-		*buffer_size = temp;
-	*buffer = current_buffer;
-	return (temp);
-}
-
-/**
-* readUserInput - function reads input from the user
-* and stores it in the buffer.
-*
-* This function reads input from the user and stores it in the buffer. If the
-* buffer is empty, it fills the buffer with user input, removes trailing
-* newline characters, and handles comments and history updates.
-*
-* @information: A pointer to the structure containing command arguments and
-* environment information.
-* @buffer: A pointer to the buffer for storing user input.
-* @buffer_size: A pointer to the buffer_size of the buffer.
-*
-* Return: Returns the number of characters read on success, -1 on failure, and
-* 0 if no characters were read (end of input).
-*/
-ssize_t readUserInput(CommandInfo *information,
-												char **buffer, size_t *buffer_size)
-{
-	ssize_t bytesRead = 0;
-	size_t bufferLength = 0;
-
-	/* Step 1: Check if the buffer is empty */
-	if (!*buffer_size)
-	{
-		/* Free the buffer if it'temp not empty */
-		free(*buffer);
-		*buffer = NULL;
-		/* Set the SIGINT signal handler and read input */
-		signal(SIGINT, handleSigInt);
-#if GETLINE
-		/* Use getline to read input from the user */
-		bytesRead = getline(buffer, &bufferLength, stdin);
-#else
-		bytesRead = custom_getline(information, buffer, &bufferLength);
-#endif
-		/* Process the input if characters were read */
-		if (bytesRead > 0)
-		{
-			if ((*buffer)[bytesRead - 1] == '\n')
-			{
-				(*buffer)[bytesRead - 1] = '\0';
-				bytesRead--;
-			}
-			/* Update flags and history */
-			information->linecount_indicator = 1;
-			Comment_Remover(*buffer);
-			history_buildList(information, *buffer, information->history_count++);
-			*buffer_size = bytesRead;
-			information->command_buffer = buffer;
-		}
-	}
-	/* Step 2: Return the number of characters read */
-	return (bytesRead);
+		*buffer_size = length;
+	*buffer = line;
+	return (length ? (ssize_t)length : -1);
 }
 
 /**
@@ -137,10 +79,42 @@ ssize_t read_input_buffer(CommandInfo *information,
 	read_result = read(information->file_descriptor, buffer, BUFFER_RD);
 	if (read_result >= 0)
 		*index = read_result;
+	if (read_result > 0)
+		shell_counters[COUNTER_BYTES_READ] += read_result;
 
 	return (read_result);
 }
 
+/**
+* input_split - function finds the end of the next command of the line.
+*
+* The command starting at the current position ends at the first ';',
+* "&&" or "||" outside quotes and compound commands, cut in place; after
+* a "&&" that failed or a "||" that succeeded, the rest of the line is
+* dropped.
+*
+* @information: A pointer to the CommandInfo structure
+* containing command information.
+*/
+static void input_split(CommandInfo *information)
+{
+	unsigned long start = trace_begin();
+
+	chain_start_position = current_position;
+	handleCommandChain(information, command_chain_buffer,
+					   &chain_start_position, current_position, buffer_length);
+	while (chain_start_position < buffer_length)
+	{
+		chain_start_position = syntax_skip(command_chain_buffer,
+										   chain_start_position, buffer_length);
+		if (detectCommandChain(information, command_chain_buffer,
+							   &chain_start_position))
+			break;
+		chain_start_position++;
+	}
+	trace_end(TRACE_PARSE, start, information->current_line);
+}
+
 /**
 * checkInput - function gets input from the command buffer.
 *
@@ -154,13 +128,11 @@ ssize_t read_input_buffer(CommandInfo *information,
 */
 ssize_t checkInput(CommandInfo *information)
 {
-	static char *command_chain_buffer;
-
-	static size_t current_position, chain_start_position, buffer_length;
 	ssize_t read_result = 0;
 	char **buffer_pointer = &(information->argument), *current_char;
 
 	print_char(BUFFER_F);
+	information->last_command = 0;
 	read_result =
 					readUserInput(information, &command_chain_buffer, &buffer_length);
 	if (read_result == -1)
@@ -168,24 +140,17 @@ ssize_t checkInput(CommandInfo *information)
 
 	if (buffer_length)
 	{
-		chain_start_position = current_position;
 		current_char = command_chain_buffer + current_position;
-
-		handleCommandChain(information, command_chain_buffer,
-															&chain_start_position, current_position, buffer_length);
-		while (chain_start_position < buffer_length)
-		{
-			if (detectCommandChain(information,
-												command_chain_buffer, &chain_start_position))
-				break;
-			chain_start_position++;
-		}
+		input_split(information);
 
 		current_position = chain_start_position + 1;
 		if (current_position >= buffer_length)
 		{
 			current_position = buffer_length = 0;
 			information->command_buffer_type = COMMAND_NORMAL;
+			information->last_command = buffer_index == read_buffer_size &&
+				!isInteractiveShell(information) &&
+				script_atEnd(information->file_descriptor);
 		}
 
 		*buffer_pointer = current_char;
@@ -195,3 +160,15 @@ ssize_t checkInput(CommandInfo *information)
 	*buffer_pointer = command_chain_buffer;
 	return (read_result);
 }
+
+/**
+* input_reset - function drops the input read but not run yet.
+*
+* A forked child that goes on to read another file must run neither the
+* rest of the line of its parent nor the lines it buffered.
+*/
+void input_reset(void)
+{
+	buffer_index = read_buffer_size = 0;
+	current_position = chain_start_position = buffer_length = 0;
+}
@@ -0,0 +1,89 @@
+#include "shell.h"
+
+/**
+* input_accept - function prepares a line just read to be run.
+*
+* The trailing newline and the comments are removed, a case statement
+* left open is completed with the lines that follow, and the line is
+* added to the history.
+*
+* @information: A pointer to the structure containing command arguments and
+* environment information.
+* @buffer: A pointer to the buffer holding the line.
+* @buffer_size: A pointer to the buffer_size of the buffer.
+* @bytesRead: The number of characters read.
+*
+* Return: The length of the line.
+*/
+static ssize_t input_accept(CommandInfo *information, char **buffer,
+							size_t *buffer_size, ssize_t bytesRead)
+{
+	if ((*buffer)[bytesRead - 1] == '\n')
+	{
+		(*buffer)[bytesRead - 1] = '\0';
+		bytesRead--;
+	}
+	/* Update flags and history */
+	information->linecount_indicator = 1;
+	Comment_Remover(*buffer);
+	bytesRead = case_continue(information, buffer);
+	history_buildList(information, *buffer, information->history_count++);
+	history_logAppend(information, *buffer);
+	*buffer_size = bytesRead;
+	information->command_buffer = buffer;
+	return (bytesRead);
+}
+
+/**
+* readUserInput - function reads input from the user
+* and stores it in the buffer.
+*
+* This function reads input from the user and stores it in the buffer. If the
+* buffer is empty, it fills the buffer with user input, removes trailing
+* newline characters, and handles comments and history updates.
+*
+* @information: A pointer to the structure containing command arguments and
+* environment information.
+* @buffer: A pointer to the buffer for storing user input.
+* @buffer_size: A pointer to the buffer_size of the buffer.
+*
+* Return: Returns the number of characters read on success, -1 on failure, and
+* 0 if no characters were read (end of input).
+*/
+ssize_t readUserInput(CommandInfo *information,
+												char **buffer, size_t *buffer_size)
+{
+	ssize_t bytesRead = 0;
+	size_t bufferLength = 0;
+	unsigned long start;
+
+	/* Step 1: Check if the buffer is empty */
+	if (!*buffer_size)
+	{
+		/* Free the buffer if it'temp not empty */
+		free(*buffer);
+		*buffer = NULL;
+		/* Set the SIGINT signal handler and read input */
+		signal(SIGINT, handleSigInt);
+		history_logSync(information);
+		start = trace_begin();
+#if GETLINE
+		/* Use getline to read input from the user */
+		bytesRead = getline(buffer, &bufferLength, stdin);
+#else
+		/* Use the line editor on a terminal, custom_getline otherwise */
+		if (editor_isAvailable(information))
+			bytesRead = editor_readLine(information, buffer, &bufferLength,
+										SHELL_PROMPT);
+		else
+			bytesRead = custom_getline(information, buffer, &bufferLength);
+#endif
+		trace_end(TRACE_READ, start, information->current_line);
+		/* Process the input if characters were read */
+		if (bytesRead > 0)
+			bytesRead = input_accept(information, buffer, buffer_size,
+									 bytesRead);
+	}
+	/* Step 2: Return the number of characters read */
+	return (bytesRead);
+}
@@ -0,0 +1,183 @@
+#include "shell.h"
+
+/**
+* output_escape - function appends the character of a backslash escape.
+*
+* @output: Pointer to the buffer to append to.
+* @text: The escape, just past the backslash.
+*
+* Return: Number of characters used after the backslash, 0 if it is not an
+* escape and the backslash was kept.
+*/
+static size_t output_escape(StringBuilder *output, const char *text)
+{
+	static const char escapes[] = "n\nt\tr\ra\ab\bv\vf\fe\033\\\\";
+	size_t i;
+	int value = 0;
+
+	for (i = 0; escapes[i]; i += 2)
+		if (text[0] == escapes[i])
+			return (builder_appendChar(output, escapes[i + 1]), 1);
+	if (text[0] < '0' || text[0] > '7')
+		return (builder_appendChar(output, '\\'), 0);
+	for (i = 0; i < 3 && text[i] >= '0' && text[i] <= '7'; i++)
+		value = value * 8 + text[i] - '0';
+	builder_appendChar(output, (char)value);
+	return (i);
+}
+
+/**
+* output_conversion - function appends one printf conversion.
+*
+* Flags, a width and a precision are accepted before the conversion
+* character, one of "sdiuxXoc". A number may be given in decimal, octal,
+* hexadecimal, or as a quote followed by a character.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @format: The format, at the '%'.
+* @arguments: The arguments left, advanced past the one used.
+*
+* Return: Number of characters of @format used.
+*/
+static size_t output_conversion(CommandInfo *information,
+								StringBuilder *output, const char *format,
+								char ***arguments)
+{
+	char single[2] = {'\0', '\0'}, *text = **arguments;
+	size_t i = 1, used, sign;
+	long number = 0;
+
+	while (format[i] && char_in_str("-+ #0", format[i]))
+		i++;
+	for (; format[i] >= '0' && format[i] <= '9'; i++)
+		;
+	for (i += format[i] == '.'; format[i] >= '0' && format[i] <= '9'; i++)
+		;
+	if (!format[i] || !char_in_str("sdiuxXoc", format[i]))
+		return (builder_appendChar(output, '%'), 1);
+	if (text)
+		(*arguments)++;
+	else
+		text = "";
+	if (format[i] == 'c')
+		single[0] = text[0], text = single;
+	else if (format[i] != 's' && (text[0] == '\'' || text[0] == '"'))
+		number = (unsigned char)text[1];
+	else if (format[i] != 's' && *text)
+	{
+		sign = text[0] == '-' || text[0] == '+';
+		used = arith_number(text + sign, str_length(text + sign), &number);
+		number = text[0] == '-' ? -number : number;
+		if (!used || text[sign + used])
+		{
+			information->execution_status = 1;
+			printErrorMessage(information, text);
+			error_print_str(": invalid number\n");
+		}
+	}
+	output_format(output, format, i, text, number);
+	return (i + 1);
+}
+
+/**
+* output_flush - function prints a built output and releases it.
+*
+* @output: Pointer to the buffer; it may contain NUL characters.
+*/
+static void output_flush(StringBuilder *output)
+{
+	size_t i;
+
+	for (i = 0; i < output->length; i++)
+		print_char(output->data[i]);
+	free(output->data);
+}
+
+/**
+* echo_command - function prints its arguments separated by blanks.
+*
+* "-n" leaves out the final newline, "-e" interprets backslash escapes and
+* "-E" stops interpreting them.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int echo_command(CommandInfo *information)
+{
+	char **arguments = information->arguments_array + 1, *text;
+	StringBuilder output = {NULL, 0, 0};
+	int newline = 1, escapes = 0;
+	size_t i;
+
+	for (; *arguments && (*arguments)[0] == '-' && (*arguments)[1]; arguments++)
+	{
+		for (i = 1; (*arguments)[i] && char_in_str("neE", (*arguments)[i]); i++)
+			;
+		if ((*arguments)[i])
+			break;
+		for (i = 1; (*arguments)[i]; i++)
+			if ((*arguments)[i] == 'n')
+				newline = 0;
+			else
+				escapes = (*arguments)[i] == 'e';
+	}
+	for (; *arguments; arguments++)
+	{
+		for (text = *arguments; *text; text++)
+			if (escapes && *text == '\\')
+				text += output_escape(&output, text + 1);
+			else
+				builder_appendChar(&output, *text);
+		if (arguments[1])
+			builder_appendChar(&output, ' ');
+	}
+	if (newline)
+		builder_appendChar(&output, '\n');
+	output_flush(&output);
+	information->execution_status = 0;
+	return (0);
+}
+
+/**
+* printf_command - function prints its arguments under control of a format.
+*
+* The format is used again as long as arguments are left and it consumed
+* some, and missing arguments read as empty strings or 0.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int printf_command(CommandInfo *information)
+{
+	char **arguments = information->arguments_array + 1, *format = *arguments;
+	char **pass;
+	StringBuilder output = {NULL, 0, 0};
+	size_t i;
+
+	information->execution_status = 0;
+	if (!format)
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "usage: printf format [arguments]\n");
+		return (0);
+	}
+	arguments++;
+	do {
+		pass = arguments;
+		for (i = 0; format[i]; i++)
+			if (format[i] == '\\')
+				i += output_escape(&output, format + i + 1);
+			else if (format[i] == '%' && format[i + 1] == '%')
+				builder_appendChar(&output, '%'), i++;
+			else if (format[i] == '%')
+				i += output_conversion(information, &output, format + i,
+									   &arguments) - 1;
+			else
+				builder_appendChar(&output, format[i]);
+	} while (*arguments && arguments != pass);
+	output_flush(&output);
+	return (0);
+}
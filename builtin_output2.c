@@ -0,0 +1,121 @@
+#include "shell.h"
+
+/**
+* output_repeat - function appends a character a number of times.
+*
+* @output: Pointer to the buffer to append to.
+* @character: The character.
+* @count: Number of times, none if negative.
+*/
+static void output_repeat(StringBuilder *output, char character, int count)
+{
+	while (count-- > 0)
+		builder_appendChar(output, character);
+}
+
+/**
+* output_spec - function reads the flags "-+ #0", the width and the
+* precision of a conversion.
+*
+* @format: The conversion, at the '%'.
+* @length: Offset of the conversion character in @format.
+* @spec: Receives what was read.
+*/
+static void output_spec(const char *format, size_t length, OutputSpec *spec)
+{
+	size_t i;
+
+	fillMemoryBlock((char *)spec, 0, sizeof(OutputSpec));
+	spec->precision = -1;
+	for (i = 1; char_in_str("-+ #0", format[i]) && i < length; i++)
+		if (format[i] == '-' || format[i] == '0')
+			*(format[i] == '-' ? &spec->left : &spec->zero) = 1;
+		else if (format[i] == '#')
+			spec->alternate = 1;
+		else if (spec->sign != '+')
+			spec->sign = format[i];
+	for (; format[i] >= '0' && format[i] <= '9' && spec->width < 65536; i++)
+		spec->width = spec->width * 10 + format[i] - '0';
+	if (format[i] == '.')
+		for (spec->precision = 0, i++; format[i] >= '0' && format[i] <= '9' &&
+			 spec->precision < 65536; i++)
+			spec->precision = spec->precision * 10 + format[i] - '0';
+}
+
+/**
+* output_number - function appends the digits of a number with its prefix,
+* the zeros the precision, '#' or '0' ask for and the padding.
+*
+* @output: Pointer to the buffer to append to.
+* @spec: The flags, width and precision.
+* @conversion: The conversion character.
+* @number: The number.
+* @prefix: The sign or "0x" to print before the digits.
+* @digits: The digits of @number, with no sign.
+*/
+static void output_number(StringBuilder *output, const OutputSpec *spec,
+						  char conversion, long number, const char *prefix,
+						  const char *digits)
+{
+	int size, zeros, total;
+
+	size = spec->precision == 0 && !number ? 0 : str_length((char *)digits);
+	zeros = spec->precision > size ? spec->precision - size : 0;
+	if (spec->alternate && conversion == 'o' && !zeros &&
+		(!size || *digits != '0'))
+		zeros = 1;
+	total = str_length((char *)prefix) + zeros + size;
+	if (spec->zero && !spec->left && spec->precision < 0 &&
+		spec->width > total)
+		zeros += spec->width - total, total = spec->width;
+	output_repeat(output, ' ', spec->left ? 0 : spec->width - total);
+	builder_append(output, prefix, str_length((char *)prefix));
+	output_repeat(output, '0', zeros);
+	builder_append(output, digits, size);
+	output_repeat(output, ' ', spec->left ? spec->width - total : 0);
+}
+
+/**
+* output_format - function appends a value the way one printf conversion
+* prints it.
+*
+* The flags "-+ #0", a width and a precision are applied as by the C
+* printf; "c" and "s" print @text, the other conversions @number, with
+* "u", "x", "X" and "o" taking it as unsigned.
+*
+* @output: Pointer to the buffer to append to.
+* @format: The conversion, at the '%'.
+* @length: Offset of the conversion character in @format.
+* @text: The string to print.
+* @number: The number to print.
+*/
+void output_format(StringBuilder *output, const char *format, size_t length,
+				   const char *text, long number)
+{
+	char conversion = format[length], *digits, prefix[3] = {'\0'};
+	OutputSpec spec;
+	int size;
+
+	output_spec(format, length, &spec);
+	if (conversion == 'c' || conversion == 's')
+	{
+		size = str_length((char *)text);
+		size = spec.precision >= 0 && spec.precision < size ?
+			spec.precision : size;
+		output_repeat(output, ' ', spec.left ? 0 : spec.width - size);
+		builder_append(output, text, size);
+		output_repeat(output, ' ', spec.left ? spec.width - size : 0);
+		return;
+	}
+	if (conversion == 'd' || conversion == 'i')
+	{
+		digits = conver_longInt_str(number, 10, 0);
+		prefix[0] = digits[0] == '-' ? *digits++ : spec.sign;
+	}
+	else
+		digits = conver_longInt_str(number, conversion == 'u' ? 10 :
+			conversion == 'o' ? 8 : 16, CON_UNS | (conversion == 'x'));
+	if (spec.alternate && number && (conversion == 'x' || conversion == 'X'))
+		prefix[0] = '0', prefix[1] = conversion;
+	output_number(output, &spec, conversion, number, prefix, digits);
+}
@@ -0,0 +1,134 @@
+#include "shell.h"
+
+/**
+* case_keyword - function tells whether "case" or "esac" starts at a
+* position as a reserved word.
+*
+* It must stand where a command may start, see syntax_command.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+* @length: Length of the line.
+* @word: "case" or "esac".
+*
+* Return: 1 if it does, 0 otherwise.
+*/
+static int case_keyword(const char *text, size_t position, size_t length,
+						const char *word)
+{
+	size_t i;
+
+	for (i = 0; i < 4; i++)
+		if (position + i >= length || text[position + i] != word[i])
+			return (0);
+	i = position + 4;
+	if (i < length && text[i] && !IfInDelimiterSet(text[i], word[0] == 'c' ?
+		" \t\n" : " \t\n;&|)"))
+		return (0);
+	return (syntax_command(text, position));
+}
+
+/**
+* syntax_case - function finds the "esac" closing a case statement.
+*
+* A whole "case ... esac" holds ";;", ';' and newlines that do not end
+* the command, so syntax_skip steps over it as one construct.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+* @length: Length of the line.
+*
+* Return: Index of the last character of the matching "esac", @length if
+* the statement is not closed yet, or 0 if none starts at @position.
+*/
+size_t syntax_case(const char *text, size_t position, size_t length)
+{
+	size_t i, depth = 0;
+
+	if (!case_keyword(text, position, length, "case"))
+		return (0);
+	for (i = position; i < length && text[i]; i++)
+	{
+		if (case_keyword(text, i, length, "case"))
+			depth++, i += 3;
+		else if (case_keyword(text, i, length, "esac") && !--depth)
+			return (i + 3);
+		else
+			i = syntax_skip(text, i, length);
+	}
+	return (length);
+}
+
+/**
+* case_open - function tells whether a line leaves a case statement, a
+* group or a subshell open.
+*
+* @text: The line.
+*
+* Return: 1 if it does, 0 otherwise.
+*/
+static int case_open(const char *text)
+{
+	size_t length = str_length((char *)text), i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (syntax_case(text, i, length) == length ||
+			syntax_group(text, i, length) == length)
+			return (1);
+		i = syntax_skip(text, i, length);
+	}
+	return (0);
+}
+
+/**
+* case_continue - function reads the lines of a case statement, a group
+* or a subshell written over several lines.
+*
+* While the input holds a "case" without its "esac", or a '{' or '('
+* without its closing '}' or ')', the next line is read, stripped of its
+* comment and joined with a newline.
+*
+* @information: Pointer to the command information structure.
+* @buffer: Pointer to the line read, reallocated as lines are joined.
+*
+* Return: Length of the line.
+*/
+ssize_t case_continue(CommandInfo *information, char **buffer)
+{
+	char *line, *joined;
+	size_t size, length = str_length(*buffer);
+	ssize_t count;
+
+	while (case_open(*buffer))
+	{
+		line = NULL, size = 0;
+		if (isInteractiveShell(information))
+			print_str(CONTINUATION_PROMPT), print_char(BUFFER_F);
+#if GETLINE
+		count = getline(&line, &size, stdin);
+#else
+		if (editor_isAvailable(information))
+			count = editor_readLine(information, &line, &size,
+									CONTINUATION_PROMPT);
+		else
+			count = custom_getline(information, &line, &size);
+#endif
+		if (count <= 0)
+			return (free(line), length);
+		if (line[count - 1] == '\n')
+			line[count - 1] = '\0';
+		Comment_Remover(line);
+		joined = malloc(length + str_length(line) + 2);
+		if (!joined)
+			return (free(line), length);
+		str_copy(joined, *buffer);
+		joined[length] = '\n', joined[length + 1] = '\0';
+		str_concatenate(joined, line);
+		free(line);
+		free(*buffer);
+		*buffer = joined;
+		length = str_length(joined);
+	}
+	return (length);
+}
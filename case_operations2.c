@@ -0,0 +1,170 @@
+#include "shell.h"
+
+/**
+* case_classes - function groups the bytes every token treats alike.
+*
+* Every set of bytes a token accepts splits the classes it cuts across,
+* so bytes of one class always move the NFA the same way and the DFA
+* needs one transition per class rather than per byte.
+*
+* @program: The program, its NFA built.
+*/
+void case_classes(CaseProgram *program)
+{
+	int classes[256], split[512], count = 1, b;
+	size_t i;
+
+	for (b = 0; b < 256; b++)
+		classes[b] = 0;
+	for (i = 0; i < program->nfa; i++)
+	{
+		if (program->tokens[i].star || program->accept[i] != -1)
+			continue;
+		for (b = 0; b < 512; b++)
+			split[b] = -1;
+		for (b = 0; b < 256; b++)
+			if (program->tokens[i].set[b >> 3] & (1 << (b & 7)))
+			{
+				if (split[classes[b]] == -1)
+					split[classes[b]] = count++;
+				classes[b] = split[classes[b]];
+			}
+		for (b = 0; b < 512; b++)
+			split[b] = -1;
+		for (b = 0, count = 0; b < 256; b++)
+		{
+			if (split[classes[b]] == -1)
+				split[classes[b]] = count++;
+			classes[b] = split[classes[b]];
+		}
+	}
+	for (b = 0; b < 256; b++)
+	{
+		program->classes[b] = classes[b];
+		program->representative[classes[b]] = b;
+	}
+	program->class_count = count;
+}
+
+/**
+* case_closure - function adds the NFA states reachable without a byte.
+*
+* A '*' may match nothing, so the state before it also stands for the
+* state after it.
+*
+* @program: The program.
+* @set: The set of NFA states.
+*/
+void case_closure(CaseProgram *program, unsigned long *set)
+{
+	size_t i;
+
+	for (i = 0; i + 1 < program->nfa; i++)
+		if (set[i / CASE_BITS] >> (i % CASE_BITS) & 1 &&
+			program->tokens[i].star)
+			set[(i + 1) / CASE_BITS] |= 1UL << ((i + 1) % CASE_BITS);
+}
+
+/**
+* case_add - function finds the DFA state of a set of NFA states, adding
+* it if it is new.
+*
+* @program: The program.
+* @set: The set of NFA states.
+*
+* Return: The DFA state, -1 if CASE_STATES_MAX states are built already.
+*/
+long case_add(CaseProgram *program, const unsigned long *set)
+{
+	size_t bytes = program->words * sizeof(unsigned long), slot, i;
+	size_t mask = 2 * CASE_STATES_MAX - 1;
+	long state;
+
+	for (slot = variable_hash((const char *)set, bytes) & mask;
+		 program->slots[slot] != -1; slot = (slot + 1) & mask)
+		if (!mem_compare(program->sets + program->slots[slot] * program->words,
+					set, bytes))
+			return (program->slots[slot]);
+	if (program->count == CASE_STATES_MAX)
+		return (-1);
+	state = program->count++;
+	program->slots[slot] = state;
+	mem_copy(program->sets + state * program->words, set, bytes);
+	for (i = 0; i < program->class_count; i++)
+		program->next[state * program->class_count + i] = -1;
+	for (i = 0; i < program->words && !set[i]; i++)
+		;
+	if (i == program->words)
+		program->dead = state;
+	return (state);
+}
+
+/**
+* case_step - function builds the transition of a DFA state on a class.
+*
+* When the DFA is full it is dropped and rebuilt from the start state, so
+* a statement met with many different words keeps a bounded table.
+*
+* @program: The program.
+* @state: The DFA state.
+* @class: The class of the byte read.
+*
+* Return: The next DFA state.
+*/
+static long case_step(CaseProgram *program, long state, size_t class)
+{
+	const unsigned long *from = program->sets + state * program->words;
+	unsigned long *set = program->scratch;
+	unsigned char byte = program->representative[class];
+	size_t i;
+	long next;
+
+	fillMemoryBlock((char *)set, 0, program->words * sizeof(unsigned long));
+	for (i = 0; i < program->nfa; i++)
+	{
+		if (!(from[i / CASE_BITS] >> (i % CASE_BITS) & 1))
+			continue;
+		if (program->tokens[i].star)
+			set[i / CASE_BITS] |= 1UL << (i % CASE_BITS);
+		else if (program->tokens[i].set[byte >> 3] & (1 << (byte & 7)))
+			set[(i + 1) / CASE_BITS] |= 1UL << ((i + 1) % CASE_BITS);
+	}
+	case_closure(program, set);
+	next = case_add(program, set);
+	if (next != -1)
+		return (program->next[state * program->class_count + class] = next);
+	program->count = 0;
+	program->dead = -1;
+	for (i = 0; i < 2 * CASE_STATES_MAX; i++)
+		program->slots[i] = -1;
+	case_add(program, program->start);
+	return (case_add(program, set));
+}
+
+/**
+* case_match - function finds the arms whose patterns match a word.
+*
+* @program: The program.
+* @word: The word.
+* @length: Length of the word.
+* @matched: One byte per arm, set to 1 for the arms that match.
+*/
+void case_match(CaseProgram *program, const char *word, size_t length,
+				char *matched)
+{
+	const unsigned long *set;
+	size_t i, class;
+	long state = 0, next;
+
+	for (i = 0; i < length && state != program->dead; i++)
+	{
+		class = program->classes[(unsigned char)word[i]];
+		next = program->next[state * program->class_count + class];
+		state = next != -1 ? next : case_step(program, state, class);
+	}
+	set = program->sets + state * program->words;
+	for (i = 0; i < program->nfa; i++)
+		if (program->accept[i] != -1 &&
+			set[i / CASE_BITS] >> (i % CASE_BITS) & 1)
+			matched[program->accept[i]] = 1;
+}
@@ -0,0 +1,170 @@
+#include "shell.h"
+
+/**
+* case_blank - function skips blanks and newlines.
+*
+* @text: The statement.
+* @position: Index to start from.
+* @length: Number of characters of @text that may be read.
+*
+* Return: Index of the next other character, or @length.
+*/
+static size_t case_blank(const char *text, size_t position, size_t length)
+{
+	while (position < length && IfInDelimiterSet(text[position], " \t\n"))
+		position++;
+	return (position);
+}
+
+/**
+* case_arm - function parses one "[(]pattern[|pattern]...) list ;;".
+*
+* @program: The program, its text set.
+* @patterns: Receives the start, the length, the arm and whether it
+* holds an expansion, for every pattern.
+* @count: Number of patterns, updated.
+* @position: Index of the arm in the text.
+*
+* Return: Index following the arm, or (size_t)-1 on a syntax error.
+*/
+static size_t case_arm(CaseProgram *program, size_t *patterns, size_t *count,
+					   size_t position)
+{
+	const char *text = program->text;
+	size_t length = program->length - 4, i = position, end, *pattern;
+	CaseArm *arm = &program->arms[program->arm_count];
+
+	if (text[i] == '(')
+		i = case_blank(text, i + 1, length);
+	for (; ; i = case_blank(text, i + 1, length))
+	{
+		pattern = patterns + 4 * (*count)++;
+		pattern[0] = i, pattern[2] = program->arm_count, pattern[3] = 0;
+		for (; i < length && !IfInDelimiterSet(text[i], "|)"); i++)
+		{
+			pattern[3] |= text[i] == '$' || text[i] == '`';
+			i = text[i] == '\\' && i + 1 < length ? i + 1 :
+				syntax_skip(text, i, length);
+		}
+		if (i >= length)
+			return ((size_t)-1);
+		end = i;
+		while (end > pattern[0] && IfInDelimiterSet(text[end - 1], " \t"))
+			end--;
+		pattern[1] = end - pattern[0];
+		if (text[i] == ')')
+			break;
+	}
+	for (arm->body = ++i; i < length; i = syntax_skip(text, i, length) + 1)
+		if (text[i] == ';' && i + 1 < length &&
+			(text[i + 1] == ';' || text[i + 1] == '&'))
+			break;
+	arm->length = i - arm->body;
+	arm->end = i + 1 < length && text[i + 1] == '&' ? CASE_FALLTHROUGH :
+			   i + 2 < length && text[i + 2] == '&' ? CASE_CONTINUE : CASE_BREAK;
+	program->arm_count++;
+	return (i < length ? i + (arm->end == CASE_CONTINUE ? 3 : 2) : i);
+}
+
+/**
+* case_parse - function parses "case word in arm... esac".
+*
+* @program: The program, its text set and its arms allocated.
+* @patterns: Receives four numbers for every pattern, see case_arm.
+* @count: Receives the number of patterns.
+*
+* Return: 0 on success, -1 on a syntax error.
+*/
+int case_parse(CaseProgram *program, size_t *patterns, size_t *count)
+{
+	const char *text = program->text;
+	size_t length = program->length - 4, i = case_blank(text, 4, length);
+
+	*count = 0;
+	for (program->word = i; i < length &&
+		 !IfInDelimiterSet(text[i], " \t\n;"); i++)
+		i = syntax_skip(text, i, length);
+	program->word_length = i - program->word;
+	i = case_blank(text, i, length);
+	if (!program->word_length || i + 2 >= length || text[i] != 'i' ||
+		text[i + 1] != 'n' || !IfInDelimiterSet(text[i + 2], " \t\n"))
+		return (-1);
+	for (i = case_blank(text, i + 2, length); i < length;
+		 i = case_blank(text, i, length))
+		i = case_arm(program, patterns, count, i);
+	return (i == length ? 0 : -1);
+}
+
+/**
+* case_nfa - function compiles the patterns of a statement into one NFA.
+*
+* Every pattern is compiled on its own, then its tokens are laid one
+* after the other, each pattern followed by a state accepting its arm.
+* A pattern holding an expansion is expanded first, and makes the program
+* one not to reuse.
+*
+* @information: Pointer to the command information structure.
+* @program: The program, parsed.
+* @patterns: Four numbers for every pattern, see case_arm.
+* @count: Number of patterns.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int case_nfa(CommandInfo *information, CaseProgram *program,
+			 const size_t *patterns, size_t count)
+{
+	GlobPattern *globs = malloc(sizeof(GlobPattern) * (count + 1));
+	size_t k, j, offset = 0;
+	int failed = !globs;
+
+	for (k = 0; !failed && k < count; k++)
+	{
+		program->dynamic |= patterns[4 * k + 3];
+		failed = (patterns[4 * k + 3] ? expand_compile(information, &globs[k],
+				  program->text + patterns[4 * k], patterns[4 * k + 1]) :
+				  glob_compile(&globs[k], program->text + patterns[4 * k],
+							   patterns[4 * k + 1])) == -1;
+		program->nfa += globs[k].count + 1;
+	}
+	program->words = program->nfa / CASE_BITS + 1;
+	program->tokens = failed ? NULL :
+					  malloc(sizeof(GlobToken) * (program->nfa + 1));
+	program->accept = failed ? NULL : malloc(sizeof(long) * (program->nfa + 1));
+	program->start = failed ? NULL :
+					 malloc(sizeof(unsigned long) * program->words);
+	failed = !program->tokens || !program->accept || !program->start;
+	if (!failed)
+		fillMemoryBlock((char *)program->start, 0,
+						sizeof(unsigned long) * program->words);
+	for (k = 0; !failed && k < count; offset += j + 1, k++)
+	{
+		program->start[offset / CASE_BITS] |= 1UL << (offset % CASE_BITS);
+		for (j = 0; j < globs[k].count; j++)
+			program->tokens[offset + j] = globs[k].tokens[j],
+			program->accept[offset + j] = -1;
+		fillMemoryBlock((char *)&program->tokens[offset + j], 0,
+						sizeof(GlobToken));
+		program->accept[offset + j] = patterns[4 * k + 2];
+	}
+	for (j = 0; globs && j < k; j++)
+		glob_free(&globs[j]);
+	free(globs);
+	return (failed ? -1 : 0);
+}
+
+/**
+* case_free - function releases the cache of compiled statements.
+*
+* @information: Pointer to the command information structure.
+*/
+void case_free(CommandInfo *information)
+{
+	int i;
+
+	if (!information->cases)
+		return;
+	for (i = 0; i < CASE_CACHE_SIZE; i++)
+		case_release(&information->cases->programs[i]);
+	free(information->cases);
+	information->cases = NULL;
+}
@@ -0,0 +1,210 @@
+#include "shell.h"
+
+/**
+* case_compile - function compiles a case statement.
+*
+* The DFA starts with its start state only; the others are built as the
+* words met need them.
+*
+* @information: Pointer to the command information structure.
+* @program: Receives the program; release it with case_release.
+* @text: The statement, from "case" to "esac".
+* @length: Length of the statement.
+*
+* Return: 0 on success, -1 on a syntax error or if memory allocation
+* fails.
+*/
+int case_compile(CommandInfo *information, CaseProgram *program,
+				 const char *text, size_t length)
+{
+	size_t bound = 1, count, i, *patterns;
+	int result = -1;
+
+	program->text = malloc(length + 1);
+	if (!program->text)
+		return (-1);
+	str_n_copy(program->text, (char *)text, length + 1);
+	program->length = length;
+	for (i = 0; i < length; i++)
+		bound += text[i] == ')' || text[i] == '|';
+	patterns = malloc(sizeof(size_t) * 4 * bound);
+	program->arms = malloc(sizeof(CaseArm) * bound);
+	if (patterns && program->arms && case_parse(program, patterns, &count) == 0
+		&& case_nfa(information, program, patterns, count) == 0)
+	{
+		case_classes(program);
+		program->scratch = malloc(sizeof(unsigned long) * program->words);
+		program->sets = malloc(sizeof(unsigned long) * program->words *
+							   CASE_STATES_MAX);
+		program->next = malloc(sizeof(long) * program->class_count *
+							   CASE_STATES_MAX);
+		program->slots = malloc(sizeof(long) * 2 * CASE_STATES_MAX);
+		if (program->scratch && program->sets && program->next &&
+			program->slots)
+		{
+			for (i = 0; i < 2 * CASE_STATES_MAX; i++)
+				program->slots[i] = -1;
+			program->dead = -1;
+			case_closure(program, program->start);
+			case_add(program, program->start);
+			result = 0;
+		}
+	}
+	free(patterns);
+	return (result);
+}
+
+/**
+* case_release - function empties a cache slot.
+*
+* @program: The slot.
+*/
+void case_release(CaseProgram *program)
+{
+	free(program->text);
+	free(program->arms);
+	free(program->tokens);
+	free(program->accept);
+	free(program->start);
+	free(program->scratch);
+	free(program->sets);
+	free(program->next);
+	free(program->slots);
+	fillMemoryBlock((char *)program, 0, sizeof(CaseProgram));
+}
+
+/**
+* case_lookup - function finds a statement in the cache, compiling it
+* into the least recently used slot if it is not there.
+*
+* @information: Pointer to the command information structure.
+* @text: The statement.
+* @length: Length of the statement.
+*
+* Return: The program, NULL on a syntax error.
+*/
+static CaseProgram *case_lookup(CommandInfo *information, const char *text,
+								size_t length)
+{
+	CaseCache *cache = information->cases;
+	CaseProgram *program, *slot = NULL;
+
+	if (!cache)
+	{
+		cache = malloc(sizeof(CaseCache));
+		if (!cache)
+			return (NULL);
+		fillMemoryBlock((char *)cache, 0, sizeof(CaseCache));
+		information->cases = cache;
+	}
+	cache->clock++;
+	for (program = cache->programs; program < cache->programs +
+		 CASE_CACHE_SIZE; program++)
+	{
+		if (program->text && !program->dynamic && program->length == length &&
+			!mem_compare(program->text, text, length))
+			return (program->used = cache->clock, program);
+		if (!program->active && (!slot || program->used < slot->used))
+			slot = program;
+	}
+	if (!slot)
+		return (NULL);
+	case_release(slot);
+	if (case_compile(information, slot, text, length) == -1)
+		return (case_release(slot), NULL);
+	slot->used = cache->clock;
+	return (slot);
+}
+
+/**
+* case_run - function runs the lists of the arms selected.
+*
+* The first arm matched runs; ";&" goes on with the list of the next arm
+* and ";;&" with the next arm matched. Newlines in a list separate its
+* commands as ';' does.
+*
+* @information: Pointer to the command information structure.
+* @program: The program.
+* @matched: One byte per arm, 1 for the arms whose patterns match.
+*
+* Return: -2 if the exit builtin ran, 0 otherwise.
+*/
+static int case_run(CommandInfo *information, CaseProgram *program,
+					const char *matched)
+{
+	size_t arm = 0, length;
+	int result = 0, end;
+	char *body;
+
+	information->execution_status = 0;
+	while (arm < program->arm_count && !matched[arm])
+		arm++;
+	while (arm < program->arm_count && result != -2)
+	{
+		length = program->arms[arm].length;
+		body = malloc(length + 1);
+		if (!body)
+			break;
+		str_n_copy(body, program->text + program->arms[arm].body, length + 1);
+		syntax_newlines(body, length);
+		result = command_runList(information, body);
+		free(body);
+		end = program->arms[arm++].end;
+		if (end == CASE_BREAK)
+			break;
+		while (end == CASE_CONTINUE && arm < program->arm_count &&
+			   !matched[arm])
+			arm++;
+	}
+	return (result);
+}
+
+/**
+* case_command - function runs a "case word in pattern) list ;; esac"
+* statement.
+*
+* The statement is compiled once and kept; running it again only expands
+* the word and walks the DFA over it, whatever the number of patterns.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 0 if the command is not a case statement, -2 if the exit
+* builtin ran, 1 otherwise. The status is the one of the last command
+* run, 0 if no pattern matched.
+*/
+int case_command(CommandInfo *information)
+{
+	char *word = information->arguments_array[0], *matched = NULL;
+	size_t length = str_length(word);
+	StringBuilder value = {NULL, 0, 0};
+	CaseProgram *program = NULL;
+	int result = 0;
+
+	if (!syntax_case(word, 0, length))
+		return (0);
+	information->current_line++;
+	if (information->argument_count == 1 &&
+		syntax_case(word, 0, length) == length - 1)
+		program = case_lookup(information, word, length);
+	if (!program)
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "syntax error\n");
+		return (1);
+	}
+	program->active++;
+	expand_text(information, &value, program->text + program->word,
+				program->word_length);
+	if (builder_reserve(&value, 0) == 0)
+		matched = malloc(program->arm_count + 1);
+	if (matched)
+	{
+		fillMemoryBlock(matched, 0, program->arm_count + 1);
+		case_match(program, value.data, value.length, matched);
+		result = case_run(information, program, matched);
+	}
+	program->active--;
+	free(value.data);
+	free(matched);
+	return (result == -2 ? -2 : 1);
+}
@@ -86,3 +86,75 @@ void handleCommandChain(CommandInfo *information, char *buffer,
 
 	*position = index;
 }
+
+/**
+* command_restore - function gives back the state of the command that was
+* being prepared when a list of commands ran.
+*
+* @information: Pointer to the command information structure.
+* @saved: The structure as it was before the list ran.
+*/
+static void command_restore(CommandInfo *information, const CommandInfo *saved)
+{
+	free(information->timing);
+	information->timing = saved->timing;
+	information->argument = saved->argument;
+	information->arguments_array = saved->arguments_array;
+	information->executable_path = saved->executable_path;
+	information->argument_count = saved->argument_count;
+	information->current_line = saved->current_line;
+	information->linecount_indicator = saved->linecount_indicator;
+	information->command_buffer_type = saved->command_buffer_type;
+	information->expansion_error = saved->expansion_error;
+	information->assignments = saved->assignments;
+	information->overlay = saved->overlay;
+	information->last_command = saved->last_command;
+}
+
+/**
+* command_runList - function runs a list of commands given as a string.
+*
+* The commands are separated by ';', "&&" and "||" as on an input line.
+* The state of the command being prepared is saved around them, so the
+* list may run while the words of that command are expanded.
+*
+* @information: Pointer to the command information structure.
+* @text: The commands, cut in place.
+*
+* Return: -2 if the exit builtin ran, 0 otherwise.
+*/
+int command_runList(CommandInfo *information, char *text)
+{
+	CommandInfo saved = *information;
+	size_t length = str_length(text), start, i;
+	int result = 0, run = 1, type;
+
+	information->linecount_indicator = 0;
+	information->last_command = 0;
+	information->timing = NULL;
+	information->overlay = NULL;
+	for (start = 0; start < length && result != -2; start = i + 1)
+	{
+		information->command_buffer_type = COMMAND_NORMAL;
+		for (i = start; i < length; i++)
+		{
+			i = syntax_skip(text, i, length);
+			if (detectCommandChain(information, text, &i))
+				break;
+		}
+		type = information->command_buffer_type;
+		if (run)
+		{
+			information->argument = text + start;
+			information_setter(information, &information->file_name);
+			result = dispatchCommand(information);
+			if (type != COMMAND_AND && type != COMMAND_OR)
+				time_report(information);
+			information_free(information, 0);
+		}
+		run = type == COMMAND_AND ? !information->execution_status :
+			type == COMMAND_OR ? information->execution_status != 0 : 1;
+	}
+	command_restore(information, &saved);
+	return (result);
+}
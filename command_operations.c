@@ -5,7 +5,10 @@
  * forkAndExecuteCommand - function forks and executes a command.
  *
  * Creates a child process using fork and executes the specified command
- * in the child process. The parent process waits for the child to complete.
+ * in the child process. The parent process waits for the child to complete,
+ * collecting its resource usage for the time keyword. The last command of
+ * a script replaces the shell instead, unless it is timed, and the zygote
+ * starts the others when there is one.
  *
  * @information: Pointer to the information structure.
  */
@@ -13,8 +16,26 @@
 void forkAndExecuteCommand(CommandInfo *information)
 {
 	pid_t childPid;
+	struct rusage usage;
+	unsigned long start = trace_begin();
 
+	/* The last command of a script needs no shell left waiting for it */
+	if (information->last_command && !information->timing)
+		exec_replace(information);
+
+	if (zygote_launch(information) == 0)
+	{
+		trace_end(TRACE_WAIT, start, information->current_line);
+		return;
+	}
+
+	/* Opened in the shell, so the cache outlives the child */
+	executable_open(information);
+
+	/* Output buffered by builtins of the same list goes first */
+	print_char(BUFFER_F);
 	childPid = fork();
+	shell_counters[COUNTER_FORKS]++;
 
 	if (childPid == -1)
 	{
@@ -22,30 +43,18 @@ void forkAndExecuteCommand(CommandInfo *information)
 		return;
 	}
 
+	/* The child never returns from command_exec */
 	if (childPid == 0)
-	{
-		if (execve(information->executable_path, information->arguments_array,
-				   getEnvironmentVariables(information)) == -1)
-		{
-			information_free(information, 1);
-
-			if (errno == EACCES)
-				exit(126);
-			exit(1);
-		}
-	}
-	else
-	{
-		wait(&(information->execution_status));
+		command_exec(information);
 
-		if (WIFEXITED(information->execution_status))
-		{
-			information->execution_status = WEXITSTATUS(information->execution_status);
+	trace_end(TRACE_FORK, start, information->current_line);
+	start = trace_begin();
+	wait4(childPid, &(information->execution_status), 0, &usage);
+	trace_end(TRACE_WAIT, start, information->current_line);
+	time_addUsage(information, &usage);
 
-			if (information->execution_status == 126)
-				printErrorMessage(information, "Permission denied\n");
-		}
-	}
+	if (WIFEXITED(information->execution_status))
+		information->execution_status = WEXITSTATUS(information->execution_status);
 }
 
 /**
@@ -60,6 +69,7 @@ void findAndExecuteCommand(CommandInfo *information)
 {
 	char *commandPath = NULL;
 	int x, wordCount;
+	unsigned long start;
 
 	information->executable_path = information->arguments_array[0];
 
@@ -76,71 +86,130 @@ void findAndExecuteCommand(CommandInfo *information)
 	if (!wordCount)
 		return;
 
+	start = trace_begin();
 	commandPath = find_command_path(information,
-									getEnvironmentVariable(information, "PATH="),
+									overlay_get(information, "PATH="),
 									information->arguments_array[0]);
+	trace_end(TRACE_LOOKUP, start, information->current_line);
 
 	if (commandPath)
-	{	information->executable_path = commandPath;
-		forkAndExecuteCommand(information);
-	}
-	else
+		information->executable_path = commandPath;
+	else if (!(isInteractiveShell(information) ||
+			   overlay_get(information, "PATH=") ||
+			   information->arguments_array[0][0] == '/') ||
+			 !isCommand(information, information->arguments_array[0]))
 	{
-		if ((isInteractiveShell(information) ||
-			 getEnvironmentVariable(information, "PATH=") ||
-			 information->arguments_array[0][0] == '/') &&
-			isCommand(information, information->arguments_array[0]))
-		{
-			forkAndExecuteCommand(information);
-		}
-		else if (*(information->argument) != '\n')
+		if (*(information->argument) != '\n')
 		{	information->execution_status = 127;
 			printErrorMessage(information, "not found\n");
 		}
+		return;
 	}
+	forkAndExecuteCommand(information);
 }
 
 /**
- * customShell - function main function for the custom shell.
+ * dispatchCommand - function runs the command in the information structure.
  *
- * Reads input, processes commands,
- * and executes them in a loop until the user exits.
- * Handles both interactive and non-interactive modes.
+ * A leading time keyword starts timing the command, then the command is
+ * run if it is a case statement, a group or a subshell, evaluated if it
+ * is a "[[ ... ]]" test or a "((...))" expression, assigned if it is made
+ * of "NAME=value" words, run as a builtin if it is one, or searched in
+ * PATH and executed. "NAME=value" words before a command only go to the
+ * environment of that command.
+ *
+ * @information: Pointer to the information structure.
+ * Return: The return value of the builtin, -1 if it was not a builtin.
+ */
+int dispatchCommand(CommandInfo *information)
+{
+	int builtinReturn;
+
+	if (information->arguments_array &&
+		str_compare(information->arguments_array[0], "time") == 0)
+		time_start(information);
+	if (!information->arguments_array || !information->arguments_array[0])
+		return (0);
+	shell_counters[COUNTER_COMMANDS]++;
+	builtinReturn = case_command(information);
+	if (!builtinReturn)
+		builtinReturn = group_command(information);
+	if (builtinReturn)
+		return (builtinReturn == -2 ? -2 : 0);
+	if (condition_command(information) || arith_command(information) ||
+		variable_assign(information))
+		return (0);
+	if (information->assignments && overlay_split(information) == -1)
+		return (0);
+	builtinReturn = executeBuiltIn(information);
+	if (builtinReturn == -1)
+		findAndExecuteCommand(information);
+	return (builtinReturn);
+}
+
+/**
+ * shell_loop - function reads and runs commands until the input ends or
+ * the exit builtin runs.
  *
  * @information: Pointer to the information structure.
  * @arguments: Command-line arguments.
- * Return: Returns the exit status or error code.
+ * Return: -2 if the exit builtin ran, the return of the last builtin
+ * otherwise.
  */
-int customShell(CommandInfo *information, char **arguments)
+int shell_loop(CommandInfo *information, char **arguments)
 {
 	ssize_t inputLength = 0;
 	int builtinReturn = 0;
+	unsigned long start;
 
 	while (inputLength != -1 && builtinReturn != -2)
 	{
 		information_clear(information);
 
 		if (isInteractiveShell(information))
-			print_str("$ ");
+			print_str(SHELL_PROMPT);
 
 		error_print_char(BUFFER_F);
 		inputLength = checkInput(information);
 
 		if (inputLength != -1)
 		{
+			start = trace_begin();
 			information_setter(information, arguments);
-			builtinReturn = executeBuiltIn(information);
+			builtinReturn = dispatchCommand(information);
+			trace_end(TRACE_COMMAND, start, information->current_line);
 
-			if (builtinReturn == -1)
-				findAndExecuteCommand(information);
+			/* A timed chain is reported once its last command ran */
+			if (information->command_buffer_type != COMMAND_AND &&
+				information->command_buffer_type != COMMAND_OR)
+				time_report(information);
 		}
 		else if (isInteractiveShell(information))
 			print_char('\n');
 
 		information_free(information, 0);
 	}
+	return (builtinReturn);
+}
+
+/**
+ * customShell - function main function for the custom shell.
+ *
+ * Reads input, processes commands,
+ * and executes them in a loop until the user exits.
+ * Handles both interactive and non-interactive modes.
+ *
+ * @information: Pointer to the information structure.
+ * @arguments: Command-line arguments.
+ * Return: Returns the exit status or error code.
+ */
+int customShell(CommandInfo *information, char **arguments)
+{
+	int builtinReturn = shell_loop(information, arguments);
 
 	history_writing(information);
+	trace_write();
+	counter_dump(information);
 	information_free(information, 1);
 
 	if (!isInteractiveShell(information) && information->execution_status)
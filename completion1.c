@@ -0,0 +1,139 @@
+#include "shell.h"
+
+/**
+* completion_add - function appends a candidate to a completion list.
+*
+* The copy has room for one more character, so a '/' can be added after
+* directory names.
+*
+* @list: Pointer to the completion list.
+* @name: The candidate.
+* @length: Number of characters of @name to copy.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int completion_add(CompletionList *list, const char *name, size_t length)
+{
+	char **grown, *copy;
+
+	if (list->count == list->capacity)
+	{
+		grown = realloc_Memory(list->names, list->capacity * sizeof(char *),
+			(list->capacity ? list->capacity * 2 : 64) * sizeof(char *));
+		if (!grown)
+			return (-1);
+		list->names = grown;
+		list->capacity = list->capacity ? list->capacity * 2 : 64;
+	}
+	copy = malloc(length + 2);
+	if (!copy)
+		return (-1);
+	str_n_copy(copy, (char *)name, length + 1);
+	list->names[list->count++] = copy;
+	return (0);
+}
+
+/**
+* completion_readDirectory - function adds the entries of a directory.
+*
+* The directory is read in large chunks with getdents64, which reports
+* the type of most entries, so only symbolic links and entries of unknown
+* type need a stat call.
+*
+* @list: Pointer to the completion list.
+* @path: The directory to read.
+* @executables: 1 to add only executable files, 0 to add every entry
+* but "." and "..", with a '/' after directory names.
+*
+* Return: 0 on success, -1 if the directory cannot be read.
+*/
+int completion_readDirectory(CompletionList *list, const char *path,
+							 int executables)
+{
+	char buffer[8192];
+	struct dirent64 *entry;
+	struct stat status;
+	int descriptor, directory;
+	long size, offset;
+
+	descriptor = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (descriptor == -1)
+		return (-1);
+	while ((size = syscall(SYS_getdents64, descriptor, buffer,
+						   sizeof(buffer))) > 0)
+		for (offset = 0; offset < size; offset += entry->d_reclen)
+		{
+			entry = (struct dirent64 *)(buffer + offset);
+			if (entry->d_name[0] == '.' && (!entry->d_name[1] ||
+				(entry->d_name[1] == '.' && !entry->d_name[2])))
+				continue;
+			directory = entry->d_type == DT_DIR;
+			if (entry->d_type == DT_LNK || entry->d_type == DT_UNKNOWN ||
+				(executables && entry->d_type == DT_REG))
+			{
+				if (fstatat(descriptor, entry->d_name, &status, 0) == -1)
+					continue;
+				directory = S_ISDIR(status.st_mode);
+				if (executables && (directory || !(status.st_mode & 0111)))
+					continue;
+			}
+			else if (executables)
+				continue;
+			if (completion_add(list, entry->d_name,
+							   str_length(entry->d_name)) == 0 &&
+				directory && !executables)
+				str_concatenate(list->names[list->count - 1], "/");
+		}
+	close(descriptor);
+	return (size == 0 ? 0 : -1);
+}
+
+/**
+* completion_compare - function orders two candidates for mem_sort.
+*
+* @first: Pointer to the first candidate.
+* @second: Pointer to the second candidate.
+*
+* Return: Negative, zero or positive as for str_compare.
+*/
+static int completion_compare(const void *first, const void *second)
+{
+	return (str_compare(*(char **)first, *(char **)second));
+}
+
+/**
+* completion_sort - function sorts a list and drops duplicate candidates.
+*
+* The same command may be found in several PATH directories; it is only
+* offered once.
+*
+* @list: Pointer to the completion list.
+*/
+void completion_sort(CompletionList *list)
+{
+	size_t i, kept = 0;
+
+	if (!list->count)
+		return;
+	mem_sort(list->names, list->count, sizeof(char *), completion_compare);
+	for (i = 1; i < list->count; i++)
+		if (str_compare(list->names[kept], list->names[i]) == 0)
+			free(list->names[i]);
+		else
+			list->names[++kept] = list->names[i];
+	list->count = kept + 1;
+}
+
+/**
+* completion_clear - function empties a completion list.
+*
+* @list: Pointer to the completion list.
+*/
+void completion_clear(CompletionList *list)
+{
+	size_t i;
+
+	for (i = 0; i < list->count; i++)
+		free(list->names[i]);
+	list->count = 0;
+}
@@ -0,0 +1,169 @@
+#include "shell.h"
+
+/**
+* completion_build - function lists the executables found in PATH.
+*
+* Every PATH directory is read and added to the inotify watches, so a
+* later change in any of them marks the list as stale. An empty PATH
+* component stands for the current directory.
+*
+* @information: Pointer to the command information structure.
+* @index: Pointer to the completion index.
+*/
+static void completion_build(CommandInfo *information, CompletionIndex *index)
+{
+	char *path = getEnvironmentVariable(information, "PATH="), *directory;
+	int start = 0, end;
+
+	completion_clear(&index->commands);
+	for (end = 0; path; end++)
+	{
+		if (path[end] && path[end] != ':')
+			continue;
+		directory = end > start ? duplicate_characters(path, start, end) : ".";
+		completion_readDirectory(&index->commands, directory, 1);
+		if (index->notify != -1)
+			inotify_add_watch(index->notify, directory, DIRECTORY_EVENTS);
+		if (!path[end])
+			break;
+		start = end + 1;
+	}
+	completion_sort(&index->commands);
+	index->stale = 0;
+}
+
+/**
+* completion_refresh - function brings the completion index up to date.
+*
+* The index is created on first use. Pending inotify events mean one of
+* the PATH directories changed, and the command list is read again.
+* Without inotify, the list is read again every time.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Pointer to the completion index, or NULL if memory allocation
+* fails.
+*/
+CompletionIndex *completion_refresh(CommandInfo *information)
+{
+	CompletionIndex *index = information->completion;
+	char events[4096];
+
+	if (!index)
+	{
+		index = malloc(sizeof(CompletionIndex));
+		if (!index)
+			return (NULL);
+		fillMemoryBlock((void *)index, 0, sizeof(CompletionIndex));
+		index->notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		descriptor_keep(&index->notify);
+		index->stale = 1;
+		information->completion = index;
+	}
+	if (index->notify == -1)
+		index->stale = 1;
+	else
+		while (read(index->notify, events, sizeof(events)) > 0)
+			index->stale = 1;
+	if (index->stale)
+		completion_build(information, index);
+	return (index);
+}
+
+/**
+* completion_invalidate - function drops the completion index.
+*
+* Called when PATH changes, so the next completion reads the new PATH
+* directories and watches them instead of the old ones.
+*
+* @information: Pointer to the command information structure.
+*/
+void completion_invalidate(CommandInfo *information)
+{
+	CompletionIndex *index = information->completion;
+
+	if (!index)
+		return;
+	completion_clear(&index->commands);
+	completion_clear(&index->files);
+	free(index->commands.names);
+	free(index->files.names);
+	free(index->directory);
+	descriptor_release(&index->notify);
+	if (index->notify != -1)
+		close(index->notify);
+	free(index);
+	information->completion = NULL;
+}
+
+/**
+* completion_files - function lists a directory for filename completion.
+*
+* The listing of the last directory is reused for COMPLETION_FILES_TTL
+* seconds, which covers the Tabs pressed while completing one word.
+*
+* @index: Pointer to the completion index.
+* @directory: The directory to list.
+*
+* Return: Pointer to the sorted listing, empty if it cannot be read.
+*/
+CompletionList *completion_files(CompletionIndex *index,
+								 const char *directory)
+{
+	time_t now = time(NULL);
+
+	if (index->directory &&
+		str_compare(index->directory, (char *)directory) == 0 &&
+		now - index->listed < COMPLETION_FILES_TTL)
+	{
+		shell_counters[COUNTER_COMPLETION_HITS]++;
+		return (&index->files);
+	}
+	shell_counters[COUNTER_COMPLETION_MISSES]++;
+	completion_clear(&index->files);
+	free(index->directory);
+	index->directory = str_duplicate((char *)directory);
+	index->listed = now;
+	completion_readDirectory(&index->files, directory, 0);
+	completion_sort(&index->files);
+	return (&index->files);
+}
+
+/**
+* completion_range - function finds the candidates starting with a prefix.
+*
+* The list is sorted, so the candidates form one run found with two
+* binary searches.
+*
+* @list: Pointer to the completion list.
+* @prefix: The text to complete.
+* @length: Number of characters of @prefix to match.
+* @first: Receives the index of the first candidate.
+*
+* Return: Number of candidates starting with @prefix.
+*/
+size_t completion_range(CompletionList *list, const char *prefix,
+						size_t length, size_t *first)
+{
+	size_t low = 0, high = list->count, middle, i, bound[2];
+	int side, order;
+
+	for (side = 0; side < 2; side++)
+	{
+		low = side ? bound[0] : 0;
+		high = list->count;
+		while (low < high)
+		{
+			middle = low + (high - low) / 2;
+			for (i = 0, order = 0; i < length && !order; i++)
+				order = list->names[middle][i] - prefix[i];
+			if (order < 0 || (side && !order))
+				low = middle + 1;
+			else
+				high = middle;
+		}
+		bound[side] = low;
+	}
+	*first = bound[0];
+	return (bound[1] - bound[0]);
+}
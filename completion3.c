@@ -0,0 +1,134 @@
+#include "shell.h"
+
+/**
+* completion_isCommand - function tells if a word is in command position.
+*
+* @line: The line being edited.
+* @start: Index of the first character of the word.
+*
+* Return: 1 if the word starts the line or follows ';', '|' or '&',
+* 0 otherwise.
+*/
+static int completion_isCommand(const char *line, size_t start)
+{
+	while (start && (line[start - 1] == ' ' || line[start - 1] == '\t'))
+		start--;
+	return (!start || IfInDelimiterSet(line[start - 1], ";|&"));
+}
+
+/**
+* completion_show - function lists the candidates under the line.
+*
+* The candidates are laid out in columns as wide as the longest one. The
+* line is drawn again in full after the list.
+*
+* @editor: Pointer to the line editor.
+* @list: Pointer to the completion list.
+* @first: Index of the first candidate.
+* @count: Number of candidates.
+*/
+static void completion_show(LineEditor *editor, CompletionList *list,
+							size_t first, size_t count)
+{
+	size_t width = 0, per_row, i, length;
+
+	if (count > COMPLETION_LIST_MAX)
+		count = COMPLETION_LIST_MAX;
+	for (i = first; i < first + count; i++)
+		if ((size_t)str_length(list->names[i]) > width)
+			width = str_length(list->names[i]);
+	per_row = editor->columns / (width + 2);
+	if (!per_row)
+		per_row = 1;
+	editor_moveTo(editor,
+				  editor_width(editor->shown.data, editor->shown_cursor),
+				  editor_width(editor->shown.data, editor->shown.length));
+	for (i = 0; i < count; i++)
+	{
+		if (i % per_row == 0)
+			builder_append(&editor->output, "\r\n", 2);
+		length = str_length(list->names[first + i]);
+		builder_append(&editor->output, list->names[first + i], length);
+		while ((i + 1) % per_row && i + 1 < count && length++ < width + 2)
+			builder_appendChar(&editor->output, ' ');
+	}
+	builder_append(&editor->output, "\r\n", 2);
+	editor->shown.length = 0;
+	editor->shown.data[0] = '\0';
+	editor->shown_cursor = 0;
+}
+
+/**
+* completion_directory - function copies the directory part of a word.
+*
+* @line: The line being edited.
+* @start: Index of the first character of the word.
+* @base: Index one past the word's last '/', @start if it has none.
+*
+* Return: The directory to list, or NULL if memory allocation fails.
+*/
+static char *completion_directory(const char *line, size_t start, size_t base)
+{
+	char *directory;
+
+	if (base == start)
+		return (str_duplicate("."));
+	directory = malloc(base - start + 1);
+	if (directory)
+		str_n_copy(directory, (char *)line + start, base - start + 1);
+	return (directory);
+}
+
+/**
+* editor_complete - function completes the word before the cursor.
+*
+* A word in command position without a '/' is completed from the PATH
+* executables, anything else from the files of its directory. The word
+* is extended as far as all candidates agree; when that adds nothing and
+* there are several candidates, they are listed.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+*/
+void editor_complete(CommandInfo *information, LineEditor *editor)
+{
+	CompletionIndex *index = completion_refresh(information);
+	CompletionList *list;
+	char *line = editor->line.data, *directory, *last;
+	size_t start = editor->cursor, base = editor->cursor, first, count;
+	size_t common, typed;
+
+	while (start && !IfInDelimiterSet(line[start - 1], " \t;|&"))
+		start--;
+	while (base > start && line[base - 1] != '/')
+		base--;
+	if (!index)
+		return;
+	if (base == start && completion_isCommand(line, start))
+		list = &index->commands;
+	else
+	{
+		directory = completion_directory(line, start, base);
+		if (!directory)
+			return;
+		list = completion_files(index, directory);
+		free(directory);
+	}
+	typed = editor->cursor - base;
+	count = completion_range(list, line + base, typed, &first);
+	if (!count)
+	{
+		builder_appendChar(&editor->output, '\a');
+		return;
+	}
+	last = list->names[first + count - 1];
+	for (common = typed; list->names[first][common] &&
+		 list->names[first][common] == last[common]; common++)
+		;
+	if (common > typed)
+		editor_insert(editor, list->names[first] + typed, common - typed);
+	if (count == 1 && last[common - 1] != '/')
+		editor_insert(editor, " ", 1);
+	else if (count > 1 && common == typed)
+		completion_show(editor, list, first, count);
+}
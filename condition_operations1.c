@@ -0,0 +1,122 @@
+#include "shell.h"
+
+/**
+* syntax_condition - function finds the "]]" closing a "[[".
+*
+* "[[" opens a conditional command where a command may start, and the
+* first "]]" standing as a word of its own closes it. What lies between
+* holds "&&", "||" and parentheses that do not end the command, so
+* syntax_skip steps over it as one construct.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+* @length: Length of the line.
+*
+* Return: Index of the second ']' of the closing "]]", @length if the
+* command is not closed, or 0 if none starts at @position.
+*/
+size_t syntax_condition(const char *text, size_t position, size_t length)
+{
+	size_t i;
+
+	if (position + 2 >= length || text[position] != '[' ||
+		text[position + 1] != '[' || !IfInDelimiterSet(text[position + 2],
+		" \t\n") || !syntax_command(text, position))
+		return (0);
+	for (i = position + 2; i + 1 < length && text[i]; i++)
+	{
+		if (text[i] == ']' && text[i + 1] == ']' &&
+			IfInDelimiterSet(text[i - 1], " \t") && (i + 2 == length ||
+			!text[i + 2] || IfInDelimiterSet(text[i + 2], " \t\n;&|)")))
+			return (i + 1);
+		i = syntax_skip(text, i, length);
+	}
+	return (length);
+}
+
+/**
+* condition_error - function reports a malformed conditional expression.
+*
+* Only the first error of an expression is reported.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser, its status set to 2.
+*/
+void condition_error(CommandInfo *information, ConditionParser *parser)
+{
+	if (parser->error)
+		return;
+	parser->error = 2;
+	printErrorMessage(information, "syntax error in conditional expression\n");
+}
+
+/**
+* condition_group - function evaluates an expression given as text, the
+* whole of a "[[ ... ]]" or a parenthesized part of it.
+*
+* @information: Pointer to the command information structure.
+* @parser: The enclosing parser, receiving the error if any.
+* @text: The expression.
+* @length: Length of the expression.
+* @run: 0 to only read the expression, its operands left unexpanded, as
+* "&&" and "||" do with the side they skip.
+*
+* Return: 1 if the expression is true, 0 otherwise.
+*/
+int condition_group(CommandInfo *information, ConditionParser *parser,
+					const char *text, size_t length, int run)
+{
+	ConditionParser inner = {NULL, 0, 0};
+	char *copy = malloc(length + 1);
+	int value = 0;
+
+	if (!copy)
+		return (0);
+	str_n_copy(copy, (char *)text, length + 1);
+	inner.words = syntax_split(copy);
+	free(copy);
+	inner.error = parser->error;
+	if (!inner.words)
+		condition_error(information, &inner);
+	else
+		value = condition_or(information, &inner, run);
+	if (inner.words && inner.words[inner.position])
+		condition_error(information, &inner);
+	freeStringArray(inner.words);
+	parser->error = inner.error;
+	return (value);
+}
+
+/**
+* condition_command - function runs a "[[ expression ]]" command.
+*
+* Operands are expanded without word splitting, the right side of "==" and
+* "!=" is a pattern and the right side of "=~" an extended regular
+* expression, compiled once and kept.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 1 if the command was one, 0 otherwise. The status is 0 when the
+* expression is true, 1 when it is false and 2 on error.
+*/
+int condition_command(CommandInfo *information)
+{
+	char *word = information->arguments_array[0];
+	size_t length = str_length(word);
+	ConditionParser parser = {NULL, 0, 0};
+	int value;
+
+	if (word[0] != '[' || !syntax_condition(word, 0, length))
+		return (0);
+	information->current_line++;
+	if (information->argument_count != 1 ||
+		syntax_condition(word, 0, length) != length - 1)
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "syntax error\n");
+		return (1);
+	}
+	value = condition_group(information, &parser, word + 2, length - 4, 1);
+	information->execution_status = parser.error ? parser.error : !value;
+	return (1);
+}
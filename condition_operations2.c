@@ -0,0 +1,146 @@
+#include "shell.h"
+
+/**
+* condition_isBinary - function tells whether a word is a binary operator
+* of conditional expressions.
+*
+* @word: The word.
+*
+* Return: 1 if it is, 0 otherwise.
+*/
+static int condition_isBinary(const char *word)
+{
+	static const char * const operators[] = {"==", "=", "!=", "=~", "<", ">",
+		"-eq", "-ne", "-lt", "-le", "-gt", "-ge", NULL};
+	int i;
+
+	for (i = 0; operators[i]; i++)
+		if (str_compare((char *)word, (char *)operators[i]) == 0)
+			return (1);
+	return (0);
+}
+
+/**
+* condition_primary - function evaluates a test, a parenthesized
+* expression or a lone operand.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser.
+* @run: 0 to only read the test.
+*
+* Return: 1 if the test is true, 0 otherwise.
+*/
+static int condition_primary(CommandInfo *information,
+							 ConditionParser *parser, int run)
+{
+	char **words = parser->words + parser->position, *word = words[0];
+	size_t length;
+	char *value;
+	int result;
+
+	if (!word || !str_compare(word, "&&") || !str_compare(word, "||"))
+		return (condition_error(information, parser), 0);
+	length = str_length(word);
+	if (word[0] == '(' && syntax_skip(word, 0, length) == length - 1)
+	{
+		parser->position++;
+		return (condition_group(information, parser, word + 1, length - 2, run));
+	}
+	if (words[1] && condition_isBinary(words[1]))
+	{
+		if (!words[2])
+			return (condition_error(information, parser), 0);
+		parser->position += 3;
+		return (run && condition_binary(information, parser, word, words[1],
+										words[2]));
+	}
+	if (words[1] && word[0] == '-' && word[1] && !word[2] &&
+		IfInDelimiterSet(word[1], "nzefdrwxsLh"))
+	{
+		parser->position += 2;
+		return (run && condition_unary(information, word, words[1]));
+	}
+	parser->position++;
+	if (!run)
+		return (0);
+	value = condition_operand(information, word);
+	result = value && *value;
+	free(value);
+	return (result);
+}
+
+/**
+* condition_not - function evaluates a test preceded by any number of '!'.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser.
+* @run: 0 to only read the test.
+*
+* Return: 1 if the test is true, 0 otherwise.
+*/
+static int condition_not(CommandInfo *information, ConditionParser *parser,
+						 int run)
+{
+	char *word = parser->words[parser->position];
+
+	if (!word || str_compare(word, "!"))
+		return (condition_primary(information, parser, run));
+	parser->position++;
+	return (!condition_not(information, parser, run));
+}
+
+/**
+* condition_and - function evaluates tests joined by "&&".
+*
+* A test after one found false is read but not evaluated.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser.
+* @run: 0 to only read the tests.
+*
+* Return: 1 if all the tests are true, 0 otherwise.
+*/
+static int condition_and(CommandInfo *information, ConditionParser *parser,
+						 int run)
+{
+	int value = condition_not(information, parser, run);
+	char *word;
+
+	while (!parser->error)
+	{
+		word = parser->words[parser->position];
+		if (!word || str_compare(word, "&&"))
+			break;
+		parser->position++;
+		value = condition_not(information, parser, run && value) && value;
+	}
+	return (value);
+}
+
+/**
+* condition_or - function evaluates an expression, tests joined by "&&"
+* binding tighter than "||".
+*
+* A test after one found true is read but not evaluated.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser.
+* @run: 0 to only read the expression.
+*
+* Return: 1 if the expression is true, 0 otherwise.
+*/
+int condition_or(CommandInfo *information, ConditionParser *parser, int run)
+{
+	int value = condition_and(information, parser, run);
+	char *word;
+
+	while (!parser->error)
+	{
+		word = parser->words[parser->position];
+		if (!word || str_compare(word, "||"))
+			break;
+		parser->position++;
+		value = condition_and(information, parser, run && !value) || value;
+	}
+	return (value);
+}
@@ -0,0 +1,169 @@
+#include "shell.h"
+
+/**
+* condition_operand - function expands an operand of a conditional
+* expression.
+*
+* The parameters and command substitutions are expanded, and the result
+* is one string whatever blanks it holds.
+*
+* @information: Pointer to the command information structure.
+* @word: The operand.
+*
+* Return: The expanded operand, to be freed, or NULL if memory allocation
+* fails.
+*/
+char *condition_operand(CommandInfo *information, const char *word)
+{
+	StringBuilder value = {NULL, 0, 0};
+
+	expand_text(information, &value, word, str_length((char *)word));
+	if (builder_reserve(&value, 0) == -1)
+		return (free(value.data), NULL);
+	return (value.data);
+}
+
+/**
+* condition_unary - function evaluates a unary test.
+*
+* -n and -z test the length of a string; -e, -f, -d, -s, -L (or -h), -r,
+* -w and -x test a file.
+*
+* @information: Pointer to the command information structure.
+* @operator: The operator.
+* @word: The operand.
+*
+* Return: 1 if the test is true, 0 otherwise.
+*/
+int condition_unary(CommandInfo *information, const char *operator,
+					const char *word)
+{
+	char *value = condition_operand(information, word), test = operator[1];
+	struct stat status;
+	int result = 0, found;
+
+	if (!value)
+		return (0);
+	found = (test == 'L' || test == 'h' ? lstat(value, &status) :
+			 stat(value, &status)) == 0;
+	if (test == 'n' || test == 'z')
+		result = (*value != '\0') == (test == 'n');
+	else if (test == 'e')
+		result = found;
+	else if (test == 'f')
+		result = found && S_ISREG(status.st_mode);
+	else if (test == 'd')
+		result = found && S_ISDIR(status.st_mode);
+	else if (test == 's')
+		result = found && status.st_size > 0;
+	else if (test == 'L' || test == 'h')
+		result = found && S_ISLNK(status.st_mode);
+	else
+		result = access(value, test == 'r' ? R_OK : test == 'w' ? W_OK :
+						X_OK) == 0;
+	free(value);
+	return (result);
+}
+
+/**
+* condition_number - function evaluates an operand of -eq, -lt and the
+* like as an arithmetic expression.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser, its status set to 1 if the evaluation fails.
+* @word: The operand.
+*
+* Return: The value, 0 on error.
+*/
+static long condition_number(CommandInfo *information,
+							 ConditionParser *parser, const char *word)
+{
+	char *text = condition_operand(information, word);
+	long value = 0;
+
+	if (text && arith_evaluate(information, text, str_length(text),
+							   &value) == -1 && !parser->error)
+		parser->error = 1;
+	free(text);
+	return (value);
+}
+
+/**
+* condition_numbers - function compares two numbers with -eq, -ne, -lt,
+* -le, -gt or -ge.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser, its status set if an operand is not valid.
+* @left: The left operand.
+* @operator: The operator.
+* @right: The right operand.
+*
+* Return: 1 if the test is true, 0 otherwise.
+*/
+static int condition_numbers(CommandInfo *information, ConditionParser *parser,
+							 const char *left, const char *operator,
+							 const char *right)
+{
+	long a = condition_number(information, parser, left);
+	long b = condition_number(information, parser, right);
+
+	return (operator[1] == 'e' ? a == b : operator[1] == 'n' ? a != b :
+			operator[1] == 'l' ? (operator[2] == 't' ? a < b : a <= b) :
+			(operator[2] == 't' ? a > b : a >= b));
+}
+
+/**
+* condition_binary - function evaluates a binary test.
+*
+* "==" (or '=') and "!=" match the left operand against the pattern on
+* the right, "=~" against an extended regular expression, '<' and '>'
+* compare strings and -eq, -ne, -lt, -le, -gt and -ge numbers.
+*
+* @information: Pointer to the command information structure.
+* @parser: The parser, its status set if an operand is not valid.
+* @left: The left operand.
+* @operator: The operator.
+* @right: The right operand.
+*
+* Return: 1 if the test is true, 0 otherwise.
+*/
+int condition_binary(CommandInfo *information, ConditionParser *parser,
+					 const char *left, const char *operator,
+					 const char *right)
+{
+	char *text, *other;
+	long result = 0;
+	GlobPattern pattern;
+
+	if (operator[0] == '-')
+		return (condition_numbers(information, parser, left, operator, right));
+	text = condition_operand(information, left);
+	if (!text)
+		return (0);
+	if (operator[1] == '~')
+	{
+		other = condition_operand(information, right);
+		result = other ? regex_match(information, text, other) : 2;
+		if (result == 2 && !parser->error)
+			parser->error = 2;
+		result = result == 0;
+		free(other);
+	}
+	else if (operator[0] == '<' || operator[0] == '>')
+	{
+		other = condition_operand(information, right);
+		result = other && (operator[0] == '<' ? str_compare(text, other) < 0 :
+						   str_compare(text, other) > 0);
+		free(other);
+	}
+	else if (expand_compile(information, &pattern, right,
+							str_length((char *)right)) == 0)
+	{
+		result = glob_prefix(&pattern, text, str_length(text), 1) ==
+				 (long)str_length(text);
+		result = operator[0] == '!' ? !result : result;
+		glob_free(&pattern);
+	}
+	free(text);
+	return (result);
+}
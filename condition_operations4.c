@@ -0,0 +1,149 @@
+#include "shell.h"
+
+/**
+* regex_release - function empties a cache slot.
+*
+* @entry: The slot.
+*/
+static void regex_release(RegexEntry *entry)
+{
+	if (entry->text)
+		regfree(&entry->compiled);
+	free(entry->text);
+	entry->text = NULL;
+	entry->used = 0;
+}
+
+/**
+* regex_lookup - function finds a pattern in the cache, compiling it into
+* the least recently used slot if it is not there.
+*
+* @information: Pointer to the command information structure.
+* @pattern: The extended regular expression.
+*
+* Return: The entry, NULL if the pattern is not valid or memory allocation
+* fails.
+*/
+static RegexEntry *regex_lookup(CommandInfo *information, const char *pattern)
+{
+	RegexCache *cache = information->regexes;
+	RegexEntry *entry, *slot = NULL;
+
+	if (!cache)
+	{
+		cache = malloc(sizeof(RegexCache));
+		if (!cache)
+			return (NULL);
+		fillMemoryBlock((char *)cache, 0, sizeof(RegexCache));
+		information->regexes = cache;
+	}
+	cache->clock++;
+	for (entry = cache->entries; entry < cache->entries + REGEX_CACHE_SIZE;
+		 entry++)
+	{
+		if (entry->text && !str_compare(entry->text, (char *)pattern))
+			return (entry->used = cache->clock, entry);
+		if (!slot || entry->used < slot->used)
+			slot = entry;
+	}
+	regex_release(slot);
+	if (regcomp(&slot->compiled, pattern, REG_EXTENDED) != 0)
+		return (NULL);
+	slot->text = str_duplicate(pattern);
+	if (!slot->text)
+		return (regfree(&slot->compiled), NULL);
+	slot->used = cache->clock;
+	return (slot);
+}
+
+/**
+* regex_capture - function stores the groups of a match in BASH_REMATCH.
+*
+* Element 0 is the whole match and element n the text of group n, empty
+* for a group that took no part in it; a failed match leaves the array
+* empty.
+*
+* @information: Pointer to the command information structure.
+* @text: The string matched.
+* @groups: The offsets of the groups, NULL if the match failed.
+* @count: Number of groups, the whole match included.
+*/
+static void regex_capture(CommandInfo *information, const char *text,
+						  const regmatch_t *groups, size_t count)
+{
+	ShellVariable *variable = variable_insert(information, "BASH_REMATCH", 12);
+	ShellArray *array;
+	size_t i, length;
+	char *element;
+
+	if (!variable || variable->flags & VARIABLE_READONLY)
+		return;
+	array_clear(variable);
+	free(variable->value);
+	variable->value = NULL;
+	variable->capacity = 0;
+	array = array_of(variable, 0);
+	for (i = 0; array && groups && i < count; i++)
+	{
+		length = groups[i].rm_so == -1 ? 0 :
+				 (size_t)(groups[i].rm_eo - groups[i].rm_so);
+		element = malloc(length + 1);
+		if (!element)
+			return;
+		str_n_copy(element, (char *)text + (groups[i].rm_so == -1 ? 0 :
+					groups[i].rm_so), length + 1);
+		if (array_setIndex(array, i, element) == -1)
+			return;
+	}
+}
+
+/**
+* regex_match - function matches a string against an extended regular
+* expression, as "[[ text =~ pattern ]]" does.
+*
+* The pattern is compiled once and kept, so a test repeated in a loop
+* only runs the matcher. The groups of the match go to BASH_REMATCH.
+*
+* @information: Pointer to the command information structure.
+* @text: The string.
+* @pattern: The extended regular expression.
+*
+* Return: 0 if the pattern matches, 1 if it does not, 2 if it is not
+* valid.
+*/
+int regex_match(CommandInfo *information, const char *text,
+				const char *pattern)
+{
+	RegexEntry *entry = regex_lookup(information, pattern);
+	regmatch_t *groups;
+	size_t count;
+	int matched;
+
+	if (!entry)
+		return (2);
+	count = entry->compiled.re_nsub + 1;
+	groups = malloc(sizeof(regmatch_t) * count);
+	if (!groups)
+		return (2);
+	matched = regexec(&entry->compiled, text, count, groups, 0) == 0;
+	regex_capture(information, text, matched ? groups : NULL, count);
+	free(groups);
+	return (!matched);
+}
+
+/**
+* regex_free - function releases the cache of compiled patterns.
+*
+* @information: Pointer to the command information structure.
+*/
+void regex_free(CommandInfo *information)
+{
+	int i;
+
+	if (!information->regexes)
+		return;
+	for (i = 0; i < REGEX_CACHE_SIZE; i++)
+		regex_release(&information->regexes->entries[i]);
+	free(information->regexes);
+	information->regexes = NULL;
+}
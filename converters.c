@@ -163,48 +163,98 @@ char **convert_list_arrstr(StringList *head)
 }
 
 /**
-* variables_replacer - function replaces variables in command arguments.
+* variables_splice - function replaces an argument by its expansion.
 *
-* This function replaces variables like "$?", "$$", and environment variables
-* in the command arguments with their corresponding values.
+* "${NAME[@]}" leaves its elements, and a glob pattern the names it
+* matches, separated by '\0' in the expansion, which is then split there
+* into one argument per element.
+*
+* @information: Pointer to the command information structure.
+* @index: Index of the argument.
+* @output: The expansion, given to the arguments.
+*
+* Return: Index of the last argument it became.
+*/
+int variables_splice(CommandInfo *information, int index,
+					 StringBuilder *output)
+{
+	char **words = information->arguments_array, **grown;
+	size_t i, start, pieces = 1;
+	int count, j;
+
+	for (i = 0; i < output->length; i++)
+		pieces += !output->data[i];
+	free(words[index]);
+	words[index] = output->data;
+	for (count = 0; words[count]; count++)
+		;
+	grown = pieces > 1 ? malloc(sizeof(char *) * (count + pieces)) : NULL;
+	if (!grown)
+		return (index);
+	for (j = 0; j < index; j++)
+		grown[j] = words[j];
+	for (start = 0; start <= output->length; start = i + 1)
+	{
+		i = start + str_length(output->data + start);
+		grown[j++] = str_duplicate(output->data + start);
+		if (!grown[j - 1])
+			grown[j - 1] = str_duplicate("");
+	}
+	for (count = index + 1; words[count]; count++)
+		grown[j++] = words[count];
+	grown[j] = NULL;
+	free(output->data);
+	free(words);
+	information->arguments_array = grown;
+	information->argument_count += pieces - 1;
+	return (index + pieces - 1);
+}
+
+/**
+* variables_replacer - function expands the parameters in command arguments.
+*
+* Every argument containing a '$' is expanded in a single pass by
+* expand_text: "$VAR", "${VAR}", "${VAR:-word}", "${VAR:=word}",
+* "${VAR:+word}", "${#VAR}", the pattern operators, "$((expression))",
+* array elements and the special parameters "$?", "$$", "$#" and "$!",
+* anywhere inside the word. "${NAME[@]}" gives one argument per element,
+* none for an empty array, except in the leading assignments. Other
+* arguments are left untouched.
 *
 * @information:Apointer to the info_t structure containing command information.
 *
-* Return: 0 on success, 1 on failure.
+* Return: 0 on success, 1 if an expansion failed and the command must not
+* run.
 */
 int variables_replacer(CommandInfo *information)
 {
-	int i = 0;
-
-	StringList *my_node;
+	StringBuilder output, *saved = information->fields;
+	char **words, *word;
+	int i, j;
 
+	information->expansion_error = 0;
 	for (i = 0; information->arguments_array[i]; i++)
 	{
-		if (information->arguments_array[i][0] != '$' ||
-														!information->arguments_array[i][1])
-			continue;
-
-		if (!str_compare(information->arguments_array[i], "$?"))
-		{
-			str_replacer(&(information->arguments_array[i]),
-					str_duplicate(conver_longInt_str(information->execution_status, 10, 0)));
+		word = information->arguments_array[i];
+		if (!char_in_str(word, '$') && !char_in_str(word, '`'))
 			continue;
-		}
-		if (!str_compare(information->arguments_array[i], "$$"))
+		output.data = NULL, output.length = 0, output.capacity = 0;
+		information->fields = i >= information->assignments ? &output : NULL;
+		expand_text(information, &output, word, str_length(word));
+		information->fields = saved;
+		words = information->arguments_array;
+		if (builder_reserve(&output, 0) == -1)
+			free(output.data);
+		else if (output.length || !i || i < information->assignments ||
+				 word[1] != '{' || !array_all(word + 2, str_length(word) - 3))
+			i = variables_splice(information, i, &output);
+		else
 		{
-			str_replacer(&(information->arguments_array[i]),
-						  str_duplicate(conver_longInt_str(getpid(), 10, 0)));
-			continue;
-		}
-		my_node = findNodeWithPrefix(information->environment_list,
-																&information->arguments_array[i][1], '=');
-		if (my_node)
-		{
-			str_replacer(&(information->arguments_array[i]),
-						  str_duplicate(char_in_str(my_node->string, '=') + 1));
-			continue;
+			free(output.data), free(word);
+			for (j = i--; words[j]; j++)
+				words[j] = words[j + 1];
+			information->argument_count--;
 		}
-		str_replacer(&information->arguments_array[i], str_duplicate(""));
 	}
-	return (0);
+	return (information->expansion_error);
 }
@@ -0,0 +1,154 @@
+#include "shell.h"
+#include <malloc.h>
+
+unsigned long shell_counters[COUNTER_MAX];
+
+/**
+* counter_append - function appends a string to a buffer.
+*
+* @output: Pointer to the buffer to append to.
+* @text: The string.
+*/
+static void counter_append(StringBuilder *output, const char *text)
+{
+	builder_append(output, text, str_length((char *)text));
+}
+
+/**
+* counter_metric - function appends one counter to a buffer.
+*
+* @output: Pointer to the buffer to append to.
+* @names: The name of the counter and its help text.
+* @index: The counter, COUNTER_MAX for the heap size gauge.
+* @pid: Process id for the Prometheus text format, NULL for the plain one.
+*/
+static void counter_metric(StringBuilder *output, const char * const *names,
+						   int index, const char *pid)
+{
+	char metric[64];
+	int counter = index < COUNTER_MAX;
+
+	str_copy(metric, pid ? "hsh_" : "");
+	str_concatenate(metric, (char *)names[0]);
+	if (pid && counter)
+		str_concatenate(metric, "_total");
+	if (pid)
+	{
+		counter_append(output, "# HELP "), counter_append(output, metric);
+		counter_append(output, " "), counter_append(output, names[1]);
+		counter_append(output, "\n# TYPE "), counter_append(output, metric);
+		counter_append(output, counter ? " counter\n" : " gauge\n");
+	}
+	counter_append(output, metric);
+	if (pid)
+		counter_append(output, "{pid=\""), counter_append(output, pid),
+		counter_append(output, "\"}");
+	counter_append(output, " ");
+	counter_append(output, conver_longInt_str(counter ?
+		shell_counters[index] : mallinfo2().uordblks, 10, CON_UNS));
+	counter_append(output, "\n");
+}
+
+/**
+* counter_format - function appends the counters to a buffer.
+*
+* The plain format is one "name value" line per counter. The Prometheus
+* text format adds HELP and TYPE lines and a pid label, so the files of
+* several sessions can be scraped together. The heap size in use is
+* added as a gauge.
+*
+* @output: Pointer to the buffer to append to.
+* @prometheus: 1 for the Prometheus text format, 0 for the plain one.
+*/
+static void counter_format(StringBuilder *output, int prometheus)
+{
+	static const char * const counters[COUNTER_MAX + 1][2] = {
+		{"commands", "Commands run"}, {"builtins", "Builtins run"},
+		{"forks", "fork() calls"}, {"stat_calls", "stat() calls of isCommand"},
+		{"allocations", "Allocations by the string and list helpers"},
+		{"read_bytes", "Bytes of input read"},
+		{"list_walks", "Linked list searches"},
+		{"list_steps", "Nodes visited by linked list searches"},
+		{"completion_hits", "Directory listings reused by completion"},
+		{"completion_misses", "Directories read by completion"},
+		{"arith_cache_hits", "Arithmetic expressions found already parsed"},
+		{"arith_cache_misses", "Arithmetic expressions parsed"},
+		{"substitutions", "Command substitutions run"},
+		{"substitutions_captured", "Command substitutions run without fork"},
+		{"execs", "Commands run in place of the shell"},
+		{"zygote_launches", "Commands started by the zygote"},
+		{"exec_cache_hits", "Programs launched from a cached descriptor"},
+		{"exec_cache_misses", "Programs opened for the executable cache"},
+		{"heap_bytes", "Heap memory in use"}};
+	char pid[24];
+	int i;
+
+	str_copy(pid, conver_longInt_str(getpid(), 10, 0));
+	for (i = 0; i <= COUNTER_MAX; i++)
+		counter_metric(output, counters[i], i, prometheus ? pid : NULL);
+}
+
+/**
+* shstat_command - function implements the shstat builtin.
+*
+* "shstat" prints the counters, "shstat -r" prints then resets them and
+* "shstat -p" prints them in the Prometheus text format.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 0 on success, 2 on an unknown option.
+*/
+int shstat_command(CommandInfo *information)
+{
+	StringBuilder output = {NULL, 0, 0};
+	char *option = information->arguments_array[1];
+	int i;
+
+	if (option && str_compare(option, "-r") && str_compare(option, "-p"))
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "Illegal option ");
+		error_print_str(option);
+		error_print_char('\n');
+		return (2);
+	}
+	counter_format(&output, option && str_compare(option, "-p") == 0);
+	print_str(output.data);
+	free(output.data);
+	if (option && str_compare(option, "-r") == 0)
+		for (i = 0; i < COUNTER_MAX; i++)
+			shell_counters[i] = 0;
+	return (0);
+}
+
+/**
+* counter_dump - function writes the counters to the HSH_STATS_FILE file.
+*
+* The file is written in the Prometheus text format under a temporary
+* name, then renamed, so a scraper never reads half a file.
+*
+* @information: Pointer to the command information structure.
+*/
+void counter_dump(CommandInfo *information)
+{
+	char *path = getEnvironmentVariable(information, "HSH_STATS_FILE=");
+	StringBuilder output = {NULL, 0, 0}, temporary = {NULL, 0, 0};
+	int descriptor, written = -1;
+
+	if (!path)
+		return;
+	counter_format(&output, 1);
+	counter_append(&temporary, path);
+	counter_append(&temporary, ".tmp");
+	descriptor = open(temporary.data, O_WRONLY | O_CREAT | O_TRUNC |
+					  O_CLOEXEC, 0644);
+	if (descriptor != -1)
+	{
+		written = write(descriptor, output.data, output.length);
+		close(descriptor);
+	}
+	if (written != (int)output.length || rename(temporary.data, path) == -1)
+		unlink(temporary.data);
+	free(output.data);
+	free(temporary.data);
+}
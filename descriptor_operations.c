@@ -0,0 +1,110 @@
+#include "shell.h"
+
+/*
+* The variables holding the descriptors the shell keeps for itself. Every
+* other descriptor belongs to the script and is inherited by its commands.
+*/
+static int *descriptor_owners[DESCRIPTOR_SLOTS];
+
+/**
+* descriptor_slot - function finds the slot of a variable in the table.
+*
+* @owner: The variable, or NULL for a free slot.
+*
+* Return: Index of the slot, -1 if there is none.
+*/
+static int descriptor_slot(int *owner)
+{
+	int i;
+
+	for (i = 0; i < DESCRIPTOR_SLOTS; i++)
+		if (descriptor_owners[i] == owner)
+			return (i);
+	return (-1);
+}
+
+/**
+* descriptor_keep - function makes a descriptor one of the shell's own.
+*
+* It moves to DESCRIPTOR_SHELL or above, out of the way of "exec 3>file",
+* and is closed on exec so no command started by the shell inherits it.
+*
+* @owner: The variable holding the descriptor, updated if it moves.
+*
+* Return: The descriptor, or -1 if @owner holds none.
+*/
+int descriptor_keep(int *owner)
+{
+	int slot = descriptor_slot(owner), moved;
+
+	if (*owner < 0)
+		return (-1);
+	if (slot == -1)
+		slot = descriptor_slot(NULL);
+	moved = *owner < DESCRIPTOR_SHELL ?
+		fcntl(*owner, F_DUPFD_CLOEXEC, DESCRIPTOR_SHELL) : -1;
+	if (moved != -1)
+		close(*owner), *owner = moved;
+	else
+		fcntl(*owner, F_SETFD, FD_CLOEXEC);
+	if (slot != -1)
+		descriptor_owners[slot] = owner;
+	return (*owner);
+}
+
+/**
+* descriptor_release - function forgets a descriptor of the shell, before
+* it is closed.
+*
+* @owner: The variable holding the descriptor.
+*/
+void descriptor_release(int *owner)
+{
+	int slot = descriptor_slot(owner);
+
+	if (slot != -1)
+		descriptor_owners[slot] = NULL;
+}
+
+/**
+* descriptor_isShell - function tells whether a descriptor is one the shell
+* keeps for itself, which a script may not name.
+*
+* @descriptor: The descriptor.
+*
+* Return: 1 if it is, 0 otherwise.
+*/
+int descriptor_isShell(int descriptor)
+{
+	int i;
+
+	for (i = 0; i < DESCRIPTOR_SLOTS; i++)
+		if (descriptor_owners[i] && *descriptor_owners[i] == descriptor)
+			return (1);
+	return (0);
+}
+
+/**
+* descriptor_free - function moves a descriptor of the shell away from a
+* number the script is about to open or close.
+*
+* @descriptor: The number wanted by the script.
+*
+* Return: 0 once the number holds nothing of the shell, -1 on failure.
+*/
+int descriptor_free(int descriptor)
+{
+	int i, moved;
+
+	for (i = 0; i < DESCRIPTOR_SLOTS; i++)
+	{
+		if (!descriptor_owners[i] || *descriptor_owners[i] != descriptor)
+			continue;
+		moved = fcntl(descriptor, F_DUPFD_CLOEXEC, DESCRIPTOR_SHELL);
+		if (moved == -1)
+			return (-1);
+		close(descriptor);
+		*descriptor_owners[i] = moved;
+	}
+	return (0);
+}
@@ -54,6 +54,19 @@ char *getEnvironmentVariable(CommandInfo *information, const char *name)
 */
 int printEnvironmentVariables(CommandInfo *information)
 {
+	char **overlay, **entry;
+
+	/* With NAME=value words before it, print what a command would get */
+	if (information->overlay)
+	{
+		overlay = overlay_environment(information);
+		for (entry = overlay; entry && *entry; entry++)
+			print_str(*entry), print_char('\n');
+		if (overlay != information->environment_variables)
+			free(overlay);
+		return (0);
+	}
+
 	/*Print the contents of the environment variables using 'print_list_str' */
 	printLinkedListStrings(information->environment_list);
 
@@ -124,6 +137,7 @@ char **getEnvironmentVariables(CommandInfo *information)
 	{
 		/* Step 2: Update 'information->environment_variables' by */
 		/* converting the linked list to an array of strings */
+		freeStringArray(information->environment_variables);
 		information->environment_variables =
 		convert_list_arrstr(information->environment_list);
 
@@ -134,3 +148,16 @@ char **getEnvironmentVariables(CommandInfo *information)
 	/* Step 4: Return the array of strings representing environment variables */
 	return (information->environment_variables);
 }
+
+/**
+* environment_free - function releases the environment list and the array
+* built from it.
+*
+* @information: Pointer to the command information structure.
+*/
+void environment_free(CommandInfo *information)
+{
+	freeLinkedList(&(information->environment_list));
+	freeStringArray(information->environment_variables);
+	information->environment_variables = NULL;
+}
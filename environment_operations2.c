@@ -1,5 +1,36 @@
 #include "shell.h"
 
+/**
+ * environment_replace - function replaces the entry of a variable already
+ * in the environment list.
+ *
+ * @information: A pointer to the structure containing environment variables.
+ * @variable: The name of the environment variable.
+ * @buffer: The new "variable=value" entry, owned by the list if replaced.
+ *
+ * Return: 1 if the variable was found and replaced, 0 otherwise.
+ */
+static int environment_replace(CommandInfo *information, char *variable,
+							   char *buffer)
+{
+	StringList *currentNode = information->environment_list;
+	char *substringStart;
+
+	while (currentNode)
+	{
+		substringStart = checkIfPrefix(currentNode->string, variable);
+		if (substringStart && *substringStart == '=')
+		{
+			free(currentNode->string);
+			currentNode->string = buffer;
+			information->environment_modified = 1;
+			return (1);
+		}
+		currentNode = currentNode->next;
+	}
+	return (0);
+}
+
 /**
  * setEnvironmentVariable - function sets or updates an environment variable.
  *
@@ -25,9 +56,6 @@ int setEnvironmentVariable(CommandInfo *information,
 {
 	char *buffer = NULL;
 
-	StringList *currentNode;
-	char *substringStart;
-
 	/* Step 1: Check if 'variable' and 'value' are not NULL */
 	if (!variable || !value)
 		return (0);
@@ -42,21 +70,13 @@ int setEnvironmentVariable(CommandInfo *information,
 	str_concatenate(buffer, "=");
 	str_concatenate(buffer, value);
 
-	/* Step 4: Traverse the linked list to check if the variable already exists */
-	currentNode = information->environment_list;
-	while (currentNode)
-	{
-		substringStart = checkIfPrefix(currentNode->string, variable);
-		if (substringStart && *substringStart == '=')
-		{
-			/* Step 5: Update the value if the variable already exists */
-			free(currentNode->string);
-			currentNode->string = buffer;
-			information->environment_modified = 1;
-			return (0);
-		}
-		currentNode = currentNode->next;
-	}
+	/* Step 4: A new PATH means new directories to complete commands from */
+	if (str_compare(variable, "PATH") == 0)
+		completion_invalidate(information);
+
+	/* Step 5: Update the value if the variable already exists */
+	if (environment_replace(information, variable, buffer))
+		return (0);
 	/* Step 6: Add a new node to the end of the linked list */
 	addNodeToEndOfList(&(information->environment_list), buffer, 0);
 	free(buffer);
@@ -95,6 +115,8 @@ int unsetEnvironmentVariable(CommandInfo *information, char *variable)
 	/* Step 1: Check if 'information->environment_list' or 'variable' is NULL */
 	if (!currentNode || !variable)
 		return (0);
+	if (str_compare(variable, "PATH") == 0)
+		completion_invalidate(information);
 
 	/* Step2 Iterate through the linked list to find and remove matching nodes */
 	while (currentNode)
@@ -141,9 +163,10 @@ int SetCustomEnvironment(CommandInfo *customInfo)
 		return (1);
 	}
 
-	/* Call a custom setenv function with provided information. */
-	if (setEnvironmentVariable(customInfo, customInfo->arguments_array[1],
-							   customInfo->arguments_array[2]))
+	/* Export it, so that a shell variable of that name does not shadow it. */
+	if (variable_export(customInfo, customInfo->arguments_array[1],
+						str_length(customInfo->arguments_array[1]),
+						customInfo->arguments_array[2]))
 		/* Return 0 if setenv was successful. */
 		return (0);
 
@@ -117,13 +117,16 @@ void error_print_str(char *inputString)
  *
  * This function prints an error message containing information such as the
  * filename, line number, command name, and a specific error string to the
- * standard error stream.
+ * standard error stream. What was printed before is written first, so the
+ * message keeps its place when a list runs with no flush between commands.
  *
  * @fileInfo: Pointer to a structure containing file information.
  * @errorString: The specific error string to be printed.
  */
 void printErrorMessage(CommandInfo *fileInfo, char *errorString)
 {
+	print_char(BUFFER_F);
+
 	/*Output the filename to the standard error stream */
 	error_print_str(fileInfo->file_name);
 
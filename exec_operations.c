@@ -0,0 +1,204 @@
+#include "shell.h"
+
+/**
+* exec_target - function points a descriptor of the shell at a file or at
+* another descriptor, for good.
+*
+* A descriptor the shell keeps for itself is moved away first, and is
+* never one the script may copy.
+*
+* @information: Pointer to the command information structure.
+* @descriptor: The descriptor to change.
+* @flags: Flags to open the file with.
+* @duplicate: 1 if @target names a descriptor, or "-" to close it.
+* @target: The file or the descriptor.
+*
+* Return: 0 on success, -1 once the error is reported.
+*/
+static int exec_target(CommandInfo *information, int descriptor, int flags,
+					   int duplicate, char *target)
+{
+	int opened = -1, i;
+
+	print_char(BUFFER_F);
+	error_print_char(BUFFER_F);
+	if (descriptor > information->descriptor_high)
+		information->descriptor_high = descriptor;
+	if (descriptor_free(descriptor) == -1)
+		return (printErrorMessage(information, "too many open files\n"), -1);
+	if (duplicate && !str_compare(target, "-"))
+		return (close(descriptor), 0);
+	if (duplicate)
+	{
+		for (i = 0, opened = 0; target[i] >= '0' && target[i] <= '9' &&
+			 opened < 65536; i++)
+			opened = opened * 10 + target[i] - '0';
+		if (!i || target[i] || descriptor_isShell(opened) ||
+			fcntl(opened, F_GETFD) == -1 ||
+			dup2(opened, descriptor) == -1)
+			return (printErrorMessage(information, target),
+					error_print_str(": bad file descriptor\n"), -1);
+		return (0);
+	}
+	opened = open(target, flags, 0644);
+	if (opened == -1 || (opened != descriptor &&
+		dup2(opened, descriptor) == -1))
+	{
+		printErrorMessage(information, "cannot open ");
+		error_print_str(target);
+		error_print_char('\n');
+		if (opened != -1)
+			close(opened);
+		return (-1);
+	}
+	if (opened != descriptor)
+		close(opened);
+	return (0);
+}
+
+/**
+* exec_redirect - function applies a redirection word given to exec.
+*
+* The forms are "[n]<file", "[n]>file", "[n]>>file", "[n]<&m", "[n]>&m"
+* and "[n]>&-", the file or the descriptor possibly in the next word.
+*
+* @information: Pointer to the command information structure.
+* @words: The words left, the redirection first.
+*
+* Return: Number of words used, 0 if the first is no redirection, or -1
+* on error.
+*/
+static int exec_redirect(CommandInfo *information, char **words)
+{
+	char *word = words[0];
+	int descriptor = 0, flags, duplicate, i;
+
+	for (i = 0; word[i] >= '0' && word[i] <= '9' && descriptor < 65536; i++)
+		descriptor = descriptor * 10 + word[i] - '0';
+	if (word[i] != '<' && word[i] != '>')
+		return (0);
+	if (!i)
+		descriptor = word[i] == '>';
+	flags = word[i] == '<' ? O_RDONLY : O_WRONLY | O_CREAT | O_TRUNC;
+	if (word[i] == '>' && word[i + 1] == '>')
+		flags = O_WRONLY | O_CREAT | O_APPEND, i++;
+	duplicate = word[i + 1] == '&' && flags != (O_WRONLY | O_CREAT | O_APPEND);
+	i += 1 + duplicate;
+	if (word[i])
+		return (exec_target(information, descriptor, flags, duplicate,
+							word + i) ? -1 : 1);
+	if (!words[1])
+	{
+		printErrorMessage(information, "syntax error\n");
+		return (-1);
+	}
+	return (exec_target(information, descriptor, flags, duplicate,
+						words[1]) ? -1 : 2);
+}
+
+/**
+* command_exec - function replaces the process with the command found.
+*
+* A program kept open by the executable cache is started from its
+* descriptor, by its path if that fails, as it does for a "#!" script
+* whose descriptor is closed on exec. A file execve refuses as no
+* executable format is read as a script. This never returns.
+*
+* @information: Pointer to the command information structure.
+*/
+void command_exec(CommandInfo *information)
+{
+	char **envp = overlay_environment(information);
+	int descriptor = information->executables ?
+		information->executables->current : -1;
+
+	if (descriptor == -1 || syscall(SYS_execveat, descriptor, "",
+		information->arguments_array, envp, AT_EMPTY_PATH) == -1)
+		execve(information->executable_path, information->arguments_array,
+			   envp);
+	if (errno == ENOEXEC)
+		script_run(information);
+	if (errno == EACCES)
+	{
+		printErrorMessage(information, "Permission denied\n");
+		error_print_char(BUFFER_F);
+		information_free(information, 1);
+		exit(126);
+	}
+	information_free(information, 1);
+	exit(1);
+}
+
+/**
+* exec_replace - function replaces the shell itself with the command found,
+* saving first what the shell saves when it exits, unless a child of the
+* shell is replaced.
+*
+* The command ends the script, or exec asked for it, so there is nothing
+* left for a parent to wait for. This never returns.
+*
+* @information: Pointer to the command information structure.
+*/
+void exec_replace(CommandInfo *information)
+{
+	shell_counters[COUNTER_EXECS]++;
+	print_char(BUFFER_F);
+	error_print_char(BUFFER_F);
+	if (!information->subshell)
+	{
+		history_writing(information);
+		trace_write();
+		counter_dump(information);
+	}
+	executable_open(information);
+	command_exec(information);
+}
+
+/**
+* exec_command - function runs the exec builtin.
+*
+* Leading redirections apply to the shell for good, then the command, if
+* any, replaces the shell, with no fork.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: -2 when a script must exit as the command is not found, 0
+* otherwise.
+*/
+int exec_command(CommandInfo *information)
+{
+	char **words = information->arguments_array, *path;
+	int i = 1, used, j;
+
+	information->execution_status = 0;
+	while (words[i] && (used = exec_redirect(information, words + i)))
+	{
+		if (used == -1)
+			return (information->execution_status = 1, 0);
+		i += used;
+	}
+	if (!words[i])
+		return (0);
+	for (j = 0; j < i; j++)
+		free(words[j]);
+	for (j = 0; words[i + j]; j++)
+		words[j] = words[i + j];
+	words[j] = NULL;
+	information->argument_count -= i;
+	path = find_command_path(information, overlay_get(information, "PATH="),
+							 words[0]);
+	for (j = 0; !path && words[0][j]; j++)
+		if (words[0][j] == '/' && isCommand(information, words[0]))
+			path = words[0];
+	if (!path)
+	{
+		information->execution_status = 127;
+		printErrorMessage(information, "not found\n");
+		error_print_char(BUFFER_F);
+		information->error_number = 127;
+		return (isInteractiveShell(information) ? 0 : -2);
+	}
+	information->executable_path = path;
+	exec_replace(information);
+	return (0);
+}
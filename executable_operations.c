@@ -0,0 +1,176 @@
+#include "shell.h"
+
+/**
+* executable_release - function empties a cache slot.
+*
+* @entry: The slot.
+*/
+static void executable_release(ExecEntry *entry)
+{
+	if (entry->path)
+	{
+		descriptor_release(&entry->descriptor);
+		close(entry->descriptor);
+	}
+	free(entry->path);
+	entry->path = NULL;
+	entry->descriptor = -1;
+	entry->used = 0;
+}
+
+/**
+* executable_watch - function opens a program and watches its directory.
+*
+* @cache: The cache.
+* @slot: The slot to open it into, empty.
+* @path: Path of the program.
+*
+* Return: 0 on success, -1 if the program cannot be opened.
+*/
+static int executable_watch(ExecCache *cache, ExecEntry *slot,
+							const char *path)
+{
+	char directory[PATH_MAX] = ".";
+	struct stat status;
+	int end = str_length((char *)path);
+
+	while (end > 0 && path[end - 1] != '/')
+		end--;
+	if (end >= PATH_MAX)
+		return (-1);
+	if (end)
+	{
+		end -= end > 1;
+		mem_copy(directory, path, end);
+		directory[end] = '\0';
+	}
+	if (inotify_add_watch(cache->notify, directory, DIRECTORY_EVENTS) == -1)
+		return (-1);
+	slot->descriptor = open(path, O_PATH | O_CLOEXEC);
+	if (slot->descriptor == -1)
+		return (-1);
+	slot->path = str_duplicate((char *)path);
+	if (!slot->path || fstat(slot->descriptor, &status) == -1)
+	{
+		free(slot->path), slot->path = NULL;
+		close(slot->descriptor), slot->descriptor = -1;
+		return (-1);
+	}
+	descriptor_keep(&slot->descriptor);
+	slot->modified = status.st_mtim;
+	return (0);
+}
+
+/**
+* executable_lookup - function finds a program in the cache, opening it
+* into the least recently used slot if it is not there or if the file
+* opened was removed or rewritten since.
+*
+* The file is checked through its descriptor, so its path is not walked
+* again; a file put in its place shows as an event of the directory.
+*
+* @cache: The cache.
+* @path: Path of the program.
+*
+* Return: The entry, NULL if the program cannot be opened.
+*/
+static ExecEntry *executable_lookup(ExecCache *cache, const char *path)
+{
+	ExecEntry *entry, *slot = NULL;
+	struct stat status;
+
+	cache->clock++;
+	for (entry = cache->entries; entry < cache->entries + EXEC_CACHE_SIZE;
+		 entry++)
+	{
+		if (entry->path && !str_compare(entry->path, (char *)path))
+		{
+			if (fstat(entry->descriptor, &status) == 0 && status.st_nlink &&
+				entry->modified.tv_sec == status.st_mtim.tv_sec &&
+				entry->modified.tv_nsec == status.st_mtim.tv_nsec)
+			{
+				shell_counters[COUNTER_EXEC_HITS]++;
+				return (entry->used = cache->clock, entry);
+			}
+			slot = entry;
+			break;
+		}
+		if (!slot || entry->used < slot->used)
+			slot = entry;
+	}
+	executable_release(slot);
+	if (executable_watch(cache, slot, path) == -1)
+		return (NULL);
+	slot->used = cache->clock;
+	shell_counters[COUNTER_EXEC_MISSES]++;
+	return (slot);
+}
+
+/**
+* executable_open - function gives the descriptor the command found is to
+* be launched from, when the HSH_EXEC_CACHE variable is set.
+*
+* Programs are kept open with O_PATH, so execveat starts them without
+* walking their path again. Pending events from their directories mean a
+* program may have been replaced, and every one is opened again; with no
+* inotify, programs are launched by their path.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: The descriptor, also left in the cache as the current one, or
+* -1 to launch the program by its path.
+*/
+int executable_open(CommandInfo *information)
+{
+	ExecCache *cache = information->executables;
+	ExecEntry *entry;
+	char events[4096];
+	int i, changed = 0;
+
+	if (cache)
+		cache->current = -1;
+	if (!getEnvironmentVariable(information, "HSH_EXEC_CACHE="))
+		return (-1);
+	if (!cache)
+	{
+		cache = malloc(sizeof(ExecCache));
+		if (!cache)
+			return (-1);
+		fillMemoryBlock((char *)cache, 0, sizeof(ExecCache));
+		for (i = 0; i < EXEC_CACHE_SIZE; i++)
+			cache->entries[i].descriptor = -1;
+		cache->current = -1;
+		cache->notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		descriptor_keep(&cache->notify);
+		information->executables = cache;
+	}
+	if (cache->notify == -1)
+		return (-1);
+	while (read(cache->notify, events, sizeof(events)) > 0)
+		changed = 1;
+	for (i = 0; changed && i < EXEC_CACHE_SIZE; i++)
+		executable_release(&cache->entries[i]);
+	entry = executable_lookup(cache, information->executable_path);
+	cache->current = entry ? entry->descriptor : -1;
+	return (cache->current);
+}
+
+/**
+* executable_free - function closes the programs kept open.
+*
+* @information: Pointer to the command information structure.
+*/
+void executable_free(CommandInfo *information)
+{
+	int i;
+
+	if (!information->executables)
+		return;
+	for (i = 0; i < EXEC_CACHE_SIZE; i++)
+		executable_release(&information->executables->entries[i]);
+	descriptor_release(&information->executables->notify);
+	if (information->executables->notify != -1)
+		close(information->executables->notify);
+	free(information->executables);
+	information->executables = NULL;
+}
@@ -1,5 +1,30 @@
 #include "shell.h"
 
+/*
+ * The builtins marked captured only print: a command substitution made of
+ * them runs in the shell process instead of a child.
+ */
+static BuiltinTable builtin_table[] = {
+	{"exit", exit_command, 0},
+	{"env", printEnvironmentVariables, 1},
+	{"help", help_command, 1},
+	{"history", print_command_history, 1},
+	{"setenv", SetCustomEnvironment, 0},
+	{"unsetenv", UnsetCustomEnvironment, 0},
+	{"cd", changeDirectory_command, 0},
+	{"alias", alias_custom, 0},
+	{"times", times_command, 1},
+	{"shstat", shstat_command, 0},
+	{"echo", echo_command, 1},
+	{"printf", printf_command, 1},
+	{"export", export_command, 0},
+	{"readonly", readonly_command, 0},
+	{"unset", unset_command, 0},
+	{"declare", declare_command, 0},
+	{"exec", exec_command, 0},
+	{NULL, NULL, 0}
+	};
+
 /**
  * executeBuiltIn - function executes a built-in command if available.
  *
@@ -13,29 +38,37 @@
 int executeBuiltIn(CommandInfo *information)
 {
 	int index, builtInResult = -1;
+	unsigned long start = trace_begin();
 
-	BuiltinTable my_builtIn_table[] = {
-		{"exit", exit_command},
-		{"env", printEnvironmentVariables},
-		{"help", help_command},
-		{"history", print_command_history},
-		{"setenv", SetCustomEnvironment},
-		{"unsetenv", UnsetCustomEnvironment},
-		{"cd", changeDirectory_command},
-		{"alias", alias_custom},
-		{NULL, NULL}
-		};
-
-	for (index = 0; my_builtIn_table[index].command_type; index++)
+	for (index = 0; builtin_table[index].command_type; index++)
 	{
 		if (str_compare(information->arguments_array[0],
-						my_builtIn_table[index].command_type) == 0)
+						builtin_table[index].command_type) == 0)
 		{
 			information->current_line++;
-			builtInResult = my_builtIn_table[index].command_function(information);
+			builtInResult = builtin_table[index].command_function(information);
+			trace_end(TRACE_BUILTIN, start, information->current_line);
+			shell_counters[COUNTER_BUILTINS]++;
 			break;
 		}
 	}
 
 	return (builtInResult);
 }
+
+/**
+ * builtin_captured - function tells whether a command is a builtin that
+ * may run in the shell process while its output is captured.
+ *
+ * @name: The command name.
+ * Return: 1 if it is one, 0 otherwise.
+ */
+int builtin_captured(char *name)
+{
+	int index;
+
+	for (index = 0; builtin_table[index].command_type; index++)
+		if (str_compare(name, builtin_table[index].command_type) == 0)
+			return (builtin_table[index].captured);
+	return (0);
+}
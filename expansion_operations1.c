@@ -0,0 +1,123 @@
+#include "shell.h"
+
+/**
+* expand_format - function writes a number in decimal.
+*
+* The digits go to a buffer of the caller, so expanding several numbers in
+* one word does not depend on the static buffer of conver_longInt_str.
+*
+* @buffer: Buffer of at least 24 characters.
+* @number: The number.
+*
+* Return: Pointer to the first digit inside @buffer.
+*/
+static char *expand_format(char *buffer, long number)
+{
+	unsigned long value = number < 0 ? -(unsigned long)number :
+						  (unsigned long)number;
+	char *digit = buffer + 23;
+
+	*digit = '\0';
+	do {
+		*--digit = '0' + value % 10;
+		value /= 10;
+	} while (value);
+	if (number < 0)
+		*--digit = '-';
+	return (digit);
+}
+
+/**
+* expand_nameLength - function measures the parameter name at the start of
+* a string.
+*
+* @text: The string, just past the '$' or "${".
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Length of the variable name, 1 for the special parameters
+* ? $ # and !, 0 if @text does not start with a parameter.
+*/
+size_t expand_nameLength(const char *text, size_t limit)
+{
+	size_t length = variable_nameLength(text, limit);
+
+	if (!length && limit && text[0] && char_in_str("?$#!", text[0]))
+		length = 1;
+	return (length);
+}
+
+/**
+* expand_lookup - function looks up the value of a parameter.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, possibly with a subscript, not NUL terminated.
+* @length: Length of the name.
+* @scratch: Buffer of 24 characters for the numeric special parameters.
+*
+* Return: The value, or NULL if the parameter is not set. The shell has
+* no positional parameters, so $# is 0, and no background jobs, so $! is
+* never set.
+*/
+const char *expand_lookup(CommandInfo *information, const char *name,
+						  size_t length, char *scratch)
+{
+	if (name[length - 1] == ']')
+		return (array_lookup(information, name, length));
+	if (length != 1 || variable_nameLength(name, 1))
+		return (variable_get(information, name, length));
+	if (name[0] == '?')
+		return (expand_format(scratch, information->execution_status));
+	if (name[0] == '$')
+		return (expand_format(scratch, getpid()));
+	if (name[0] == '#')
+		return ("0");
+	return (NULL);
+}
+
+/**
+* expand_closing - function finds the '}' closing a "${".
+*
+* @text: The string, just past the "${".
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Index of the closing '}', or -1 if there is none. Nested "${"
+* are skipped with their own '}'.
+*/
+long expand_closing(const char *text, size_t limit)
+{
+	size_t i, depth = 0;
+
+	for (i = 0; i < limit && text[i]; i++)
+	{
+		if (text[i] == '$' && i + 1 < limit && text[i + 1] == '{')
+			depth++, i++;
+		else if (text[i] == '}' && !depth--)
+			return (i);
+	}
+	return (-1);
+}
+
+/**
+* expand_length - function appends the length of a parameter's value, or
+* the number of elements of "NAME[@]".
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*/
+void expand_length(CommandInfo *information, StringBuilder *output,
+				   const char *name, size_t length)
+{
+	char scratch[24], *digits;
+	const char *value;
+	size_t count;
+
+	if (!array_count(information, name, length, &count))
+	{
+		value = expand_lookup(information, name, length, scratch);
+		count = value ? str_length((char *)value) : 0;
+	}
+	digits = expand_format(scratch, count);
+	builder_append(output, digits, str_length(digits));
+}
@@ -0,0 +1,203 @@
+#include "shell.h"
+
+/**
+* expand_operator - function expands "${NAME<op>word}".
+*
+* The operators are '-' (use word if unset), '=' (assign word if unset)
+* and '+' (use word if set). With a leading ':' an empty value counts as
+* unset. The word is itself expanded, and only when it is used.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The operator and the word, up to the closing '}' excluded.
+* @limit: Length of @text.
+*
+* Return: 0 on success, -1 if @text does not start with an operator.
+*/
+static int expand_operator(CommandInfo *information, StringBuilder *output,
+						   const char *name, size_t length,
+						   const char *text, size_t limit)
+{
+	StringBuilder word = {NULL, 0, 0};
+	char scratch[24];
+	const char *value = expand_lookup(information, name, length, scratch);
+	size_t colon = text[0] == ':';
+	int set = value && (!colon || *value);
+
+	if (colon == limit || !char_in_str("-=+", text[colon]))
+		return (-1);
+	if (text[colon] != '+' && set)
+		builder_append(output, value, str_length((char *)value));
+	if (set != (text[colon] == '+'))
+		return (0);
+	expand_text(information, &word, text + colon + 1, limit - colon - 1);
+	if (builder_reserve(&word, 0) == -1)
+		return (0);
+	if (text[colon] == '=' && variable_nameLength(name, length) == length)
+		variable_set(information, name, length, word.data);
+	builder_append(output, word.data, word.length);
+	free(word.data);
+	return (0);
+}
+
+/**
+* expand_braced - function expands a "${...}" parameter.
+*
+* The name may carry a subscript, "${NAME[subscript]}"; "${NAME[@]}" and
+* "${!NAME[@]}" give all the elements or all the keys of an array.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @text: The string, just past the "${".
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Number of characters used, closing '}' included, or 0 if the
+* expansion is malformed and the '$' is to be kept as it is.
+*/
+static size_t expand_braced(CommandInfo *information, StringBuilder *output,
+							const char *text, size_t limit)
+{
+	long end = expand_closing(text, limit);
+	size_t count = (text[0] == '#' || text[0] == '!') && text[1] != '}';
+	size_t length;
+	char scratch[24];
+	const char *value;
+
+	if (end < 0)
+		return (0);
+	length = expand_nameLength(text + count, end - count);
+	if (length && variable_nameLength(text + count, length) == length)
+		length += array_subscript(text + count + length,
+								  end - count - length);
+	if (!length || (count && count + length != (size_t)end))
+		return (0);
+	if (count && text[0] == '!')
+	{
+		if (!array_expand(information, output, text + 1, length, 1))
+			return (0);
+	}
+	else if (count)
+		expand_length(information, output, text + 1, length);
+	else if (length == (size_t)end)
+	{
+		value = array_expand(information, output, text, length, 0) ? NULL :
+				expand_lookup(information, text, length, scratch);
+		if (value)
+			builder_append(output, value, str_length((char *)value));
+	}
+	else if (expand_operator(information, output, text, length,
+							 text + length, end - length) == -1 &&
+			 expand_modifier(information, output, text, length,
+							 text + length, end - length) == -1)
+		return (0);
+	return (end + 1);
+}
+
+/**
+* expand_parameter - function expands the parameter after a '$'.
+*
+* This covers "${...}", "$((...))" and "$(...)" as well.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @text: The string, just past the '$'.
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Number of characters used, or 0 if no parameter follows and the
+* '$' is to be kept as it is.
+*/
+static size_t expand_parameter(CommandInfo *information, StringBuilder *output,
+							   const char *text, size_t limit)
+{
+	size_t length;
+	char scratch[24];
+	const char *value;
+
+	if (text[0] == '{')
+	{
+		length = expand_braced(information, output, text + 1, limit - 1);
+		return (length ? length + 1 : 0);
+	}
+	if (text[0] == '(' && limit > 1 && text[1] == '(')
+		return (expand_arithmetic(information, output, text, limit));
+	if (text[0] == '(')
+	{
+		length = syntax_skip(text, 0, limit);
+		if (length)
+			expand_command(information, output, text + 1, length - 1);
+		return (length ? length + 1 : 0);
+	}
+	length = expand_nameLength(text, limit);
+	if (!length)
+		return (0);
+	value = expand_lookup(information, text, length, scratch);
+	if (value)
+		builder_append(output, value, str_length((char *)value));
+	return (length);
+}
+
+/**
+* expand_text - function appends a string with its parameters expanded.
+*
+* The string is read once, left to right: literal runs are copied as they
+* are and every parameter is looked up in place, its value appended, as is
+* the output of every "`...`" command substitution.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @text: The string.
+* @limit: Length of @text.
+*/
+void expand_text(CommandInfo *information, StringBuilder *output,
+				 const char *text, size_t limit)
+{
+	size_t i = 0, run, used;
+
+	while (i < limit)
+	{
+		for (run = i; i < limit && text[i] != '$' && text[i] != '`'; i++)
+			;
+		builder_append(output, text + run, i - run);
+		if (i == limit)
+			break;
+		if (text[i] == '`')
+		{
+			used = syntax_skip(text, i, limit) - i;
+			if (used)
+				expand_command(information, output, text + i + 1, used - 1);
+		}
+		else
+			used = i + 1 < limit ? expand_parameter(information, output,
+								   text + i + 1, limit - i - 1) : 0;
+		if (!used)
+			builder_appendChar(output, text[i]);
+		i += used + 1;
+	}
+}
+
+/**
+* expand_word - function expands the parameters and command substitutions
+* of a word.
+*
+* @information: Pointer to the command information structure.
+* @word: The word.
+*
+* Return: The expanded word, or NULL if it has nothing to expand (or
+* memory allocation fails), in which case it is used as it is.
+*/
+char *expand_word(CommandInfo *information, char *word)
+{
+	StringBuilder output = {NULL, 0, 0};
+
+	if (!char_in_str(word, '$') && !char_in_str(word, '`'))
+		return (NULL);
+	expand_text(information, &output, word, str_length(word));
+	if (builder_reserve(&output, 0) == -1)
+	{
+		free(output.data);
+		return (NULL);
+	}
+	return (output.data);
+}
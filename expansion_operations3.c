@@ -0,0 +1,144 @@
+#include "shell.h"
+
+/**
+* expand_separator - function finds a separator inside "${...}".
+*
+* Nested "${...}" are skipped whole, and a character after '\\' is never
+* a separator.
+*
+* @text: The string to search.
+* @limit: Length of @text.
+* @separator: The separator.
+*
+* Return: Index of the separator, or @limit if there is none.
+*/
+size_t expand_separator(const char *text, size_t limit, char separator)
+{
+	size_t i;
+	long end;
+
+	for (i = 0; i < limit && text[i] != separator; i++)
+	{
+		if (text[i] == '\\')
+			i++;
+		else if (text[i] == '$' && i + 1 < limit && text[i + 1] == '{')
+		{
+			end = expand_closing(text + i + 2, limit - i - 2);
+			if (end < 0)
+				return (limit);
+			i += end + 2;
+		}
+	}
+	return (i < limit ? i : limit);
+}
+
+/**
+* expand_compile - function expands a pattern and compiles it.
+*
+* @information: Pointer to the command information structure.
+* @pattern: Receives the compiled pattern; release it with glob_free.
+* @text: The pattern, before parameter expansion.
+* @limit: Length of @text.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int expand_compile(CommandInfo *information, GlobPattern *pattern,
+				   const char *text, size_t limit)
+{
+	StringBuilder expanded = {NULL, 0, 0};
+	int result;
+
+	expand_text(information, &expanded, text, limit);
+	result = glob_compile(pattern, expanded.data ? expanded.data : "",
+						  expanded.length);
+	free(expanded.data);
+	return (result);
+}
+
+/**
+* expand_number - function evaluates an offset or a length.
+*
+* @information: Pointer to the command information structure.
+* @text: Arithmetic expression, before parameter expansion. A negative
+* one is written after a blank or in parentheses, so it does not read as
+* the ":-" operator.
+* @limit: Length of @text.
+*
+* Return: The number, 0 if @text is empty or fails to evaluate.
+*/
+static long expand_number(CommandInfo *information, const char *text,
+						  size_t limit)
+{
+	StringBuilder expanded = {NULL, 0, 0};
+	long number = 0;
+
+	expand_text(information, &expanded, text, limit);
+	if (arith_evaluate(information, expanded.data ? expanded.data : "",
+					   expanded.length, &number) == -1)
+		information->expansion_error = 1;
+	free(expanded.data);
+	return (number);
+}
+
+/**
+* expand_value - function looks up the value of a parameter, unset ones
+* reading as empty.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @scratch: Buffer of 24 characters for the numeric special parameters.
+*
+* Return: The value.
+*/
+const char *expand_value(CommandInfo *information, const char *name,
+						 size_t length, char *scratch)
+{
+	const char *value = expand_lookup(information, name, length, scratch);
+
+	return (value ? value : "");
+}
+
+/**
+* expand_substring - function expands "${NAME:offset}" and
+* "${NAME:offset:length}".
+*
+* A negative offset counts from the end of the value, a negative length
+* gives the end position counted from the end. For "NAME[@]" they count
+* elements, as array_slice does.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The ':' and what follows, up to the closing '}' excluded.
+* @limit: Length of @text.
+*/
+void expand_substring(CommandInfo *information, StringBuilder *output,
+					  const char *name, size_t length,
+					  const char *text, size_t limit)
+{
+	size_t colon = expand_separator(text + 1, limit - 1, ':') + 1;
+	long size, start, end;
+	char scratch[24];
+	const char *value;
+
+	start = expand_number(information, text + 1, colon - 1);
+	end = colon < limit ? expand_number(information, text + colon + 1,
+										limit - colon - 1) : LONG_MAX;
+	if (array_slice(information, output, name, length, start, end))
+		return;
+	value = expand_value(information, name, length, scratch);
+	size = str_length((char *)value);
+	if (start < 0)
+		start += size;
+	if (end < 0)
+		end += size;
+	else if (end != LONG_MAX)
+		end += start;
+	if (end > size)
+		end = size;
+	if (start < 0 || start >= end)
+		return;
+	builder_append(output, value + start, end - start);
+}
@@ -0,0 +1,178 @@
+#include "shell.h"
+
+/**
+* expand_trim - function expands "${NAME#pattern}" and its variants.
+*
+* '#' removes the shortest prefix matching the pattern, "##" the longest;
+* '%' and "%%" do the same with suffixes. The pattern is compiled once,
+* then tried at every position a suffix may start, of every element for
+* "NAME[@]".
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The operator and the pattern, up to the closing '}' excluded.
+* @limit: Length of @text.
+*/
+static void expand_trim(CommandInfo *information, StringBuilder *output,
+						const char *name, size_t length,
+						const char *text, size_t limit)
+{
+	size_t longest = limit > 1 && text[1] == text[0], i, size, start, end;
+	size_t position = 0;
+	char scratch[24];
+	const char *value;
+	GlobPattern pattern;
+	long matched;
+
+	if (expand_compile(information, &pattern, text + 1 + longest,
+					   limit - 1 - longest))
+		return;
+	while ((value = array_each(information, output, name, length, &position,
+							   scratch)))
+	{
+		size = str_length((char *)value);
+		start = 0, end = size;
+		if (text[0] == '#')
+		{
+			matched = glob_prefix(&pattern, value, size, longest);
+			start = matched < 0 ? 0 : matched;
+		}
+		for (i = 0; text[0] == '%' && i <= size; i++)
+		{
+			end = longest ? i : size - i;
+			if (glob_prefix(&pattern, value + end, size - end, 1) ==
+				(long)(size - end))
+				break;
+		}
+		if (text[0] == '%' && i > size)
+			end = size;
+		builder_append(output, value + start, end - start);
+	}
+	glob_free(&pattern);
+}
+
+/**
+* expand_replace - function expands "${NAME/pattern/string}".
+*
+* "/" replaces the first longest match of the pattern, "//" every match,
+* "/#" a match at the start only and "/%" a match at the end only. The
+* pattern and the string are expanded once, before the value, or every
+* element for "NAME[@]", is scanned.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The operator, pattern and string, up to the closing '}' excluded.
+* @limit: Length of @text.
+*/
+static void expand_replace(CommandInfo *information, StringBuilder *output,
+						   const char *name, size_t length,
+						   const char *text, size_t limit)
+{
+	char mode = limit > 1 && char_in_str("/#%", text[1]) ? text[1] : 0;
+	size_t skip = mode ? 2 : 1, size, i, position = 0;
+	size_t slash = expand_separator(text + skip, limit - skip, '/') + skip;
+	StringBuilder replacement = {NULL, 0, 0};
+	char scratch[24];
+	const char *value;
+	int replaced;
+	GlobPattern pattern;
+	long matched;
+
+	if (expand_compile(information, &pattern, text + skip, slash - skip))
+		return;
+	if (slash < limit)
+		expand_text(information, &replacement, text + slash + 1,
+					limit - slash - 1);
+	while ((value = array_each(information, output, name, length, &position,
+							   scratch)))
+		for (size = str_length((char *)value), i = 0, replaced = 0;
+			 i <= size; i += matched > 0 ? matched : 1)
+		{
+			matched = -1;
+			if ((mode == '/' || !replaced) && (mode != '#' || !i))
+				matched = glob_prefix(&pattern, value + i, size - i, 1);
+			if (mode == '%' && matched != (long)(size - i))
+				matched = -1;
+			if (matched > 0 || (matched == 0 && (mode == '#' || mode == '%')))
+			{
+				builder_append(output, replacement.data, replacement.length);
+				replaced = 1;
+			}
+			if (matched <= 0 && i < size)
+				builder_appendChar(output, value[i]);
+		}
+	free(replacement.data);
+	glob_free(&pattern);
+}
+
+/**
+* expand_arithmetic - function expands "$((expression))".
+*
+* Parameters inside the expression are expanded first, then it is
+* evaluated; a failure drops the whole command.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @text: The string, just past the '$', at the "((".
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Number of characters used, or 0 if the "((" is not closed by
+* "))" and the '$' is to be kept as it is.
+*/
+size_t expand_arithmetic(CommandInfo *information, StringBuilder *output,
+						 const char *text, size_t limit)
+{
+	size_t end = syntax_skip(text, 0, limit);
+	StringBuilder expression = {NULL, 0, 0};
+	char *digits;
+	long value;
+
+	if (!end || text[end - 1] != ')')
+		return (0);
+	expand_text(information, &expression, text + 2, end - 3);
+	if (arith_evaluate(information, expression.data ? expression.data : "",
+					   expression.length, &value) == -1)
+		information->expansion_error = 1;
+	else
+	{
+		digits = conver_longInt_str(value, 10, 0);
+		builder_append(output, digits, str_length(digits));
+	}
+	free(expression.data);
+	return (end + 1);
+}
+
+/**
+* expand_modifier - function expands the pattern and substring operators.
+*
+* The operands are expanded before the value is looked up, since they may
+* assign the parameter with ":=".
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @text: The operator and its operands, up to the closing '}' excluded.
+* @limit: Length of @text.
+*
+* Return: 0 on success, -1 if @text does not start with one of the
+* operators # ## % %% / // : handled here.
+*/
+int expand_modifier(CommandInfo *information, StringBuilder *output,
+					const char *name, size_t length,
+					const char *text, size_t limit)
+{
+	if (text[0] == '#' || text[0] == '%')
+		expand_trim(information, output, name, length, text, limit);
+	else if (text[0] == '/')
+		expand_replace(information, output, name, length, text, limit);
+	else if (text[0] == ':' && limit > 1)
+		expand_substring(information, output, name, length, text, limit);
+	else
+		return (-1);
+	return (0);
+}
@@ -175,6 +175,7 @@ char *str_duplicate(const char *originalString)
 
 	/* Step 3: Allocate memory for the duplicated string */
 	duplicate = malloc(sizeof(char) * (length + 1));
+	shell_counters[COUNTER_ALLOCATIONS]++;
 
 	/* Step 4: Check if memory allocation was successful */
 	if (!duplicate)
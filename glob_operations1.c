@@ -0,0 +1,169 @@
+#include "shell.h"
+
+/**
+* glob_class - function compiles a bracket expression.
+*
+* "[abc]", "[a-z]" and their negations "[!...]" or "[^...]" are supported;
+* a ']' right after the '[' (or its negation) is taken literally.
+*
+* @token: Receives the set of accepted bytes.
+* @text: The pattern, at the '['.
+* @length: Number of characters of @text that may be read.
+*
+* Return: Number of characters of the bracket expression, 0 if it is not
+* closed, in which case the '[' is a literal character.
+*/
+static size_t glob_class(GlobToken *token, const unsigned char *text,
+						 size_t length)
+{
+	size_t i = 1, negate = 0, c, first, last;
+
+	if (i < length && (text[i] == '!' || text[i] == '^'))
+		negate = 1, i++;
+	for (c = i; c < length && (text[c] != ']' || c == i); c++)
+		;
+	if (c >= length)
+		return (0);
+	for (; i < c; i++)
+	{
+		first = text[i];
+		last = first;
+		if (i + 2 < c && text[i + 1] == '-')
+			last = text[i + 2], i += 2;
+		for (; first <= last; first++)
+			token->set[first >> 3] |= 1 << (first & 7);
+	}
+	for (i = 0; negate && i < 32; i++)
+		token->set[i] = ~token->set[i];
+	return (c + 1);
+}
+
+/**
+* glob_compile - function compiles a glob pattern.
+*
+* '*' matches any run of characters, '?' any one character, brackets one
+* of a set, and '\\' makes the next character literal. The pattern is
+* compiled once, then matched at as many positions as needed.
+*
+* @pattern: Receives the compiled pattern; release it with glob_free.
+* @text: The pattern.
+* @length: Length of the pattern.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int glob_compile(GlobPattern *pattern, const char *text, size_t length)
+{
+	const unsigned char *bytes = (const unsigned char *)text;
+	GlobToken *token;
+	size_t i = 0, used;
+
+	pattern->count = 0;
+	pattern->tokens = malloc(sizeof(GlobToken) * (length + 1));
+	pattern->states = malloc(2 * (length + 1));
+	if (!pattern->tokens || !pattern->states)
+		return (glob_free(pattern), -1);
+	while (i < length)
+	{
+		token = &pattern->tokens[pattern->count];
+		fillMemoryBlock((char *)token, 0, sizeof(GlobToken));
+		token->star = bytes[i] == '*';
+		used = bytes[i] == '[' ? glob_class(token, bytes + i, length - i) : 0;
+		if (bytes[i] == '?')
+			fillMemoryBlock((char *)token->set, (char)0xff, 32);
+		else if (!token->star && !used)
+		{
+			if (bytes[i] == '\\' && i + 1 < length)
+				i++;
+			token->set[bytes[i] >> 3] |= 1 << (bytes[i] & 7);
+		}
+		i += used ? used : 1;
+		if (!token->star || !pattern->count ||
+			!pattern->tokens[pattern->count - 1].star)
+			pattern->count++;
+	}
+	return (0);
+}
+
+/**
+* glob_free - function releases a compiled pattern.
+*
+* @pattern: The pattern.
+*/
+void glob_free(GlobPattern *pattern)
+{
+	free(pattern->tokens);
+	free(pattern->states);
+	pattern->tokens = NULL;
+	pattern->states = NULL;
+	pattern->count = 0;
+}
+
+/**
+* glob_closure - function adds the states reachable without a character.
+*
+* A '*' may match nothing, so the state before it also stands for the
+* state after it.
+*
+* @pattern: The pattern.
+* @states: The set of states, one byte per state.
+*
+* Return: 1 if any state is in the set, 0 otherwise.
+*/
+static int glob_closure(GlobPattern *pattern, unsigned char *states)
+{
+	size_t i;
+	int any = 0;
+
+	for (i = 0; i <= pattern->count; i++)
+	{
+		if (states[i] && i < pattern->count && pattern->tokens[i].star)
+			states[i + 1] = 1;
+		any |= states[i];
+	}
+	return (any);
+}
+
+/**
+* glob_prefix - function matches a pattern against the start of a string.
+*
+* The pattern runs as a set of states over the string, so one pass finds
+* every prefix it matches, without backtracking.
+*
+* @pattern: The compiled pattern.
+* @text: The string.
+* @length: Length of the string.
+* @longest: 1 for the longest matching prefix, 0 for the shortest.
+*
+* Return: Length of the matching prefix, -1 if no prefix matches.
+*/
+long glob_prefix(GlobPattern *pattern, const char *text, size_t length,
+				 int longest)
+{
+	unsigned char *current = pattern->states, *next, *swap, c;
+	size_t size = pattern->count + 1, i, position;
+	long best = -1;
+
+	next = current + size;
+	fillMemoryBlock((char *)current, 0, size);
+	current[0] = 1;
+	glob_closure(pattern, current);
+	for (position = 0; ; position++)
+	{
+		if (current[pattern->count])
+			best = position;
+		if (position == length || (best != -1 && !longest))
+			break;
+		c = text[position];
+		fillMemoryBlock((char *)next, 0, size);
+		for (i = 0; i < pattern->count; i++)
+			if (current[i] && pattern->tokens[i].star)
+				next[i] = 1;
+			else if (current[i] &&
+					 pattern->tokens[i].set[c >> 3] & (1 << (c & 7)))
+				next[i + 1] = 1;
+		swap = current, current = next, next = swap;
+		if (!glob_closure(pattern, current))
+			break;
+	}
+	return (best);
+}
@@ -0,0 +1,139 @@
+#include "shell.h"
+
+/**
+* glob_isPattern - function tells whether a word is a glob pattern.
+*
+* @text: The word.
+* @length: Number of characters of @text to look at.
+*
+* Return: 1 if it holds a '*', a '?' or a closed bracket expression not
+* escaped by a '\\', 0 otherwise.
+*/
+int glob_isPattern(const char *text, size_t length)
+{
+	size_t i, j;
+
+	for (i = 0; i < length; i++)
+	{
+		if (text[i] == '\\')
+			i++;
+		else if (text[i] == '*' || text[i] == '?')
+			return (1);
+		else if (text[i] == '[')
+			for (j = i + 2; j < length; j++)
+				if (text[j] == ']')
+					return (1);
+	}
+	return (0);
+}
+
+/**
+* glob_compare - function orders two paths for mem_sort.
+*
+* The first bytes of every path are packed, most significant first, into
+* a number, so most comparisons are one integer comparison; paths with
+* the same first bytes fall back to mem_compare, which stops at the first
+* difference, the end of the shorter path at the latest. Both order
+* unsigned bytes, whatever the locale.
+*
+* @first: Pointer to the key of the first path.
+* @second: Pointer to the key of the second path.
+*
+* Return: Negative, zero or positive as the first path is lower, equal or
+* greater.
+*/
+static int glob_compare(const void *first, const void *second)
+{
+	const GlobKey *a = first, *b = second;
+
+	if (a->prefix != b->prefix)
+		return (a->prefix < b->prefix ? -1 : 1);
+	return (mem_compare(a->name, b->name, str_length(a->name) + 1));
+}
+
+/**
+* glob_sort - function sorts paths bytewise.
+*
+* Paths already in order, as a single match is, need no more than a
+* check.
+*
+* @list: The paths.
+*/
+void glob_sort(CompletionList *list)
+{
+	GlobKey *keys;
+	size_t i, j, byte;
+
+	for (i = 1; i < list->count; i++)
+		if (mem_compare(list->names[i - 1], list->names[i],
+						str_length(list->names[i - 1]) + 1) > 0)
+			break;
+	keys = i < list->count ? malloc(sizeof(GlobKey) * list->count) : NULL;
+	if (!keys)
+		return;
+	for (i = 0; i < list->count; i++)
+	{
+		keys[i].name = list->names[i], keys[i].prefix = 0;
+		for (j = 0, byte = 1; j < sizeof(unsigned long); j++)
+		{
+			byte = byte ? (unsigned char)keys[i].name[j] : 0;
+			keys[i].prefix = keys[i].prefix << 8 | byte;
+		}
+	}
+	mem_sort(keys, list->count, sizeof(GlobKey), glob_compare);
+	for (i = 0; i < list->count; i++)
+		list->names[i] = keys[i].name;
+	free(keys);
+}
+
+/**
+* glob_directory - function gives the entries of a directory, reading it
+* only the first time.
+*
+* @cache: Pointer to the directories listed so far.
+* @path: The directory, "" for the current one.
+*
+* Return: The entries, none if the directory cannot be read, or NULL if
+* memory allocation fails.
+*/
+CompletionList *glob_directory(GlobDirectory **cache, const char *path)
+{
+	GlobDirectory *directory;
+
+	for (directory = *cache; directory; directory = directory->next)
+		if (str_compare(directory->path, (char *)path) == 0)
+			return (&directory->entries);
+	directory = malloc(sizeof(GlobDirectory));
+	if (!directory)
+		return (NULL);
+	fillMemoryBlock((char *)directory, 0, sizeof(GlobDirectory));
+	directory->path = str_duplicate(path);
+	if (!directory->path)
+		return (free(directory), NULL);
+	if (completion_readDirectory(&directory->entries, *path ? path : ".",
+								 0) == -1)
+		completion_clear(&directory->entries);
+	directory->next = *cache;
+	*cache = directory;
+	return (&directory->entries);
+}
+
+/**
+* glob_forget - function releases the directories listed.
+*
+* @cache: Pointer to the directories listed.
+*/
+void glob_forget(GlobDirectory **cache)
+{
+	GlobDirectory *directory;
+
+	while (*cache)
+	{
+		directory = *cache;
+		*cache = directory->next;
+		completion_clear(&directory->entries);
+		free(directory->entries.names);
+		free(directory->path);
+		free(directory);
+	}
+}
@@ -0,0 +1,123 @@
+#include "shell.h"
+
+/**
+* glob_literal - function appends a path component holding no pattern,
+* without the '\\' escaping its characters.
+*
+* @path: The path being built.
+* @text: The component.
+* @length: Length of the component.
+*/
+static void glob_literal(StringBuilder *path, const char *text, size_t length)
+{
+	size_t i;
+
+	for (i = 0; i < length; i++)
+	{
+		if (text[i] == '\\' && i + 1 < length)
+			i++;
+		builder_appendChar(path, text[i]);
+	}
+}
+
+/**
+* glob_entries - function matches a path component against the entries
+* of the directory reached so far.
+*
+* A leading '.' must be matched by a '.' written in the pattern, and only
+* directories are followed when more components remain.
+*
+* @cache: Pointer to the directories listed so far.
+* @path: The path matched so far, restored before returning.
+* @pattern: The rest of the pattern, at the component.
+* @end: Length of the component.
+* @matches: Receives the paths matched.
+*/
+static void glob_entries(GlobDirectory **cache, StringBuilder *path,
+						 const char *pattern, size_t end,
+						 CompletionList *matches)
+{
+	size_t mark = path->length, i, length;
+	CompletionList *entries;
+	GlobPattern compiled;
+	char *name;
+	int directory;
+
+	entries = glob_directory(cache, path->data ? path->data : "");
+	if (!entries || glob_compile(&compiled, pattern, end) == -1)
+		return;
+	for (i = 0; i < entries->count; i++)
+	{
+		name = entries->names[i];
+		length = str_length(name);
+		directory = name[length - 1] == '/';
+		length -= directory;
+		if ((name[0] == '.' && pattern[0] != '.') || (pattern[end] &&
+			!directory) || !glob_match(&compiled, name, length))
+			continue;
+		builder_append(path, name, length);
+		if (pattern[end])
+			glob_walk(cache, path, pattern + end, matches);
+		else
+			completion_add(matches, path->data, path->length);
+		path->length = mark, path->data[mark] = '\0';
+	}
+	glob_free(&compiled);
+}
+
+/**
+* glob_walk - function finds the paths matching the rest of a pattern.
+*
+* Components without a pattern are taken as they are, the others are
+* matched by glob_entries.
+*
+* @cache: Pointer to the directories listed so far.
+* @path: The path matched so far, restored before returning.
+* @pattern: The rest of the pattern.
+* @matches: Receives the paths matched.
+*/
+void glob_walk(GlobDirectory **cache, StringBuilder *path,
+			   const char *pattern, CompletionList *matches)
+{
+	size_t base = path->length, end;
+	struct stat status;
+
+	while (*pattern == '/')
+		builder_appendChar(path, *pattern++);
+	for (end = 0; pattern[end] && pattern[end] != '/'; end++)
+		;
+	if (end && glob_isPattern(pattern, end))
+		glob_entries(cache, path, pattern, end, matches);
+	else
+	{
+		glob_literal(path, pattern, end);
+		if (end && pattern[end])
+			glob_walk(cache, path, pattern + end, matches);
+		else if (path->data && lstat(path->data, &status) == 0)
+			completion_add(matches, path->data, path->length);
+	}
+	path->length = base;
+	if (path->data)
+		path->data[base] = '\0';
+}
+
+/**
+* glob_expand - function finds the paths a glob pattern matches.
+*
+* @cache: Pointer to the directories listed so far, shared by the words
+* of a command line so each directory is read once.
+* @word: The pattern.
+* @matches: Receives the paths matched, in the order of the listings.
+*
+* Return: Number of paths matched.
+*/
+int glob_expand(GlobDirectory **cache, const char *word,
+				CompletionList *matches)
+{
+	StringBuilder path = {NULL, 0, 0};
+	size_t before = matches->count;
+
+	glob_walk(cache, &path, word, matches);
+	free(path.data);
+	return (matches->count - before);
+}
@@ -0,0 +1,86 @@
+#include "shell.h"
+
+/**
+* glob_match - function matches a pattern against a whole string.
+*
+* Characters are matched one by one; on a mismatch the last '*' met
+* takes one more character and matching resumes after it. Going back to
+* an earlier '*' is never needed, so the match is linear for most
+* patterns, and it stops at the first character that cannot match, as
+* most names of a directory do.
+*
+* @pattern: The compiled pattern.
+* @text: The string.
+* @length: Length of the string.
+*
+* Return: 1 if the pattern matches the whole string, 0 otherwise.
+*/
+int glob_match(GlobPattern *pattern, const char *text, size_t length)
+{
+	GlobToken *tokens = pattern->tokens;
+	size_t t = 0, p = 0, star = (size_t)-1, resume = 0;
+	unsigned char c;
+
+	while (t < length)
+	{
+		c = text[t];
+		if (p < pattern->count && tokens[p].star)
+			star = p++, resume = t;
+		else if (p < pattern->count && tokens[p].set[c >> 3] & (1 << (c & 7)))
+			p++, t++;
+		else if (star != (size_t)-1)
+			p = star + 1, t = ++resume;
+		else
+			return (0);
+	}
+	while (p < pattern->count && tokens[p].star)
+		p++;
+	return (p == pattern->count);
+}
+
+/**
+* glob_replacer - function expands the glob patterns in command arguments.
+*
+* Every argument after the leading assignments holding a '*', a '?' or a
+* bracket expression becomes the paths it matches, sorted bytewise
+* whatever the locale, or stays as it is if it matches none. The
+* directories read are kept until every argument is expanded.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0, a pattern matching nothing not being an error.
+*/
+int glob_replacer(CommandInfo *information)
+{
+	CompletionList matches = {NULL, 0, 0};
+	GlobDirectory *cache = NULL;
+	StringBuilder output;
+	char *word;
+	size_t j;
+	int i;
+
+	for (i = information->assignments; information->arguments_array[i]; i++)
+	{
+		word = information->arguments_array[i];
+		if ((word[0] == '(' && word[1] == '(') ||
+			!glob_isPattern(word, str_length(word)) ||
+			glob_expand(&cache, word, &matches) == 0)
+			continue;
+		glob_sort(&matches);
+		output.data = NULL, output.length = 0, output.capacity = 0;
+		for (j = 0; j < matches.count; j++)
+			builder_append(&output, matches.names[j],
+						   str_length(matches.names[j]) + 1);
+		completion_clear(&matches);
+		if (builder_reserve(&output, 0) == -1)
+		{
+			free(output.data);
+			continue;
+		}
+		output.data[--output.length] = '\0';
+		i = variables_splice(information, i, &output);
+	}
+	free(matches.names);
+	glob_forget(&cache);
+	return (0);
+}
@@ -0,0 +1,78 @@
+#include "shell.h"
+
+/**
+* group_subshell - function runs a list in a child of the shell.
+*
+* The child already holds the parsed list, the variables and the caches
+* of the shell, so it runs the list as it is, with no exec and no start
+* up; whatever the list changes is lost when it exits.
+*
+* @information: Pointer to the command information structure.
+* @body: The commands.
+*/
+static void group_subshell(CommandInfo *information, char *body)
+{
+	struct rusage usage;
+	pid_t child;
+	int status;
+
+	print_char(BUFFER_F);
+	error_print_char(BUFFER_F);
+	child = fork();
+	shell_counters[COUNTER_FORKS]++;
+	if (child == -1)
+	{
+		perror("Error:");
+		return;
+	}
+	if (child == 0)
+	{
+		information->subshell = 1;
+		child_exit(information, command_runList(information, body));
+	}
+	wait4(child, &status, 0, &usage);
+	time_addUsage(information, &usage);
+	information->execution_status = WIFEXITED(status) ?
+		WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+/**
+* group_command - function runs a "{ list; }" group or a "( list )"
+* subshell.
+*
+* A group runs in the shell, so its assignments and cd stay; a subshell
+* runs in a forked child.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 0 if the command is not a group, -2 if the exit builtin ran in
+* a group, 1 otherwise. The status is the one of the last command run.
+*/
+int group_command(CommandInfo *information)
+{
+	char *word = information->arguments_array[0], *body;
+	size_t length = str_length(word), end = syntax_group(word, 0, length);
+	int result = 0;
+
+	if (!end)
+		return (0);
+	information->current_line++;
+	if (information->argument_count != 1 || end != length - 1)
+	{
+		information->execution_status = 2;
+		printErrorMessage(information, "syntax error\n");
+		return (1);
+	}
+	body = malloc(length - 1);
+	if (!body)
+		return (1);
+	str_n_copy(body, word + 1, length - 1);
+	syntax_newlines(body, length - 2);
+	information->execution_status = 0;
+	if (word[0] == '{')
+		result = command_runList(information, body);
+	else
+		group_subshell(information, body);
+	free(body);
+	return (result == -2 ? -2 : 1);
+}
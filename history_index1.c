@@ -0,0 +1,208 @@
+#include "shell.h"
+
+/**
+* history_indexRehash - function resizes the trigram posting table.
+*
+* @index: Pointer to the history index.
+* @capacity: New number of slots, a power of two.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int history_indexRehash(HistoryIndex *index, size_t capacity)
+{
+	HistoryPosting *old = index->postings, *posting;
+	size_t old_capacity = index->posting_capacity, i;
+
+	index->postings = malloc(sizeof(HistoryPosting) * capacity);
+	if (!index->postings)
+	{
+		index->postings = old;
+		return (-1);
+	}
+	fillMemoryBlock((void *)index->postings, 0,
+					sizeof(HistoryPosting) * capacity);
+	index->posting_capacity = capacity;
+	index->posting_count = 0;
+
+	/* Move every posting list to its slot in the new table */
+	for (i = 0; i < old_capacity; i++)
+		if (old[i].key)
+		{
+			posting = history_indexPosting(index, old[i].key, 1);
+			*posting = old[i];
+		}
+	free(old);
+	return (0);
+}
+
+/**
+* history_indexPosting - function finds the posting list of a trigram.
+*
+* The posting lists are kept in an open addressing hash table with linear
+* probing, grown to keep it at most half full.
+*
+* @index: Pointer to the history index.
+* @key: The trigram, its three bytes packed into an integer.
+* @create: 1 to add an empty posting list if the trigram is new.
+*
+* Return: Pointer to the posting list, or NULL if there is none.
+*/
+HistoryPosting *history_indexPosting(HistoryIndex *index,
+									 unsigned int key, int create)
+{
+	size_t slot, mask;
+
+	if (create && (index->posting_count + 1) * 2 > index->posting_capacity &&
+		history_indexRehash(index, index->posting_capacity ?
+							index->posting_capacity * 2 : 1024) == -1)
+		return (NULL);
+	if (!index->posting_capacity)
+		return (NULL);
+	mask = index->posting_capacity - 1;
+	slot = ((key * 2654435761U) ^ (key >> 7)) & mask;
+	while (index->postings[slot].key && index->postings[slot].key != key)
+		slot = (slot + 1) & mask;
+	if (index->postings[slot].key == key)
+		return (&index->postings[slot]);
+	if (!create)
+		return (NULL);
+	index->postings[slot].key = key;
+	index->posting_count++;
+	return (&index->postings[slot]);
+}
+
+/**
+* history_indexTrie - function adds an entry to the prefix trie.
+*
+* Every node on the path of the entry's first HISTORY_TRIE_DEPTH
+* characters records the entry as the newest one with that prefix.
+*
+* @index: Pointer to the history index.
+* @id: Id of the entry to add.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int history_indexTrie(HistoryIndex *index, int id)
+{
+	const unsigned char *text = (unsigned char *)index->entries[id];
+	HistoryTrieNode *nodes;
+	int node = 0, child, depth;
+
+	for (depth = 0; depth <= HISTORY_TRIE_DEPTH; depth++)
+	{
+		if (index->node_count + 1 > index->node_capacity)
+		{
+			nodes = realloc_Memory(index->nodes,
+				index->node_capacity * sizeof(HistoryTrieNode),
+				(index->node_capacity ? index->node_capacity * 2 : 256) *
+				sizeof(HistoryTrieNode));
+			if (!nodes)
+				return (-1);
+			index->nodes = nodes;
+			index->node_capacity = index->node_capacity ?
+								   index->node_capacity * 2 : 256;
+			if (!index->node_count)
+				fillMemoryBlock((void *)&nodes[index->node_count++], 0,
+								sizeof(HistoryTrieNode));
+		}
+		index->nodes[node].latest = id;
+		if (depth == HISTORY_TRIE_DEPTH || !text[depth])
+			break;
+		for (child = index->nodes[node].child; child &&
+			 index->nodes[child].byte != text[depth];
+			 child = index->nodes[child].sibling)
+			;
+		if (!child)
+		{
+			child = index->node_count++;
+			index->nodes[child].child = 0;
+			index->nodes[child].byte = text[depth];
+			index->nodes[child].sibling = index->nodes[node].child;
+			index->nodes[node].child = child;
+		}
+		node = child;
+	}
+	return (0);
+}
+
+/**
+* history_indexAppend - function appends an entry id to a posting list,
+* once however many times the trigram occurs in the entry.
+*
+* @posting: The posting list.
+* @id: The entry id, no smaller than the ids already in the list.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int history_indexAppend(HistoryPosting *posting, unsigned int id)
+{
+	void *grown;
+
+	if (posting->count && posting->ids[posting->count - 1] == id)
+		return (0);
+	if (posting->count == posting->capacity)
+	{
+		grown = realloc_Memory(posting->ids,
+			posting->capacity * sizeof(unsigned int),
+			(posting->capacity ? posting->capacity * 2 : 4) *
+			sizeof(unsigned int));
+		if (!grown)
+			return (-1);
+		posting->ids = grown;
+		posting->capacity = posting->capacity ? posting->capacity * 2 : 4;
+	}
+	posting->ids[posting->count++] = id;
+	return (0);
+}
+
+/**
+* history_indexAdd - function adds an entry to the history index.
+*
+* The index is created on first use. The entry is copied, its id is
+* appended to the posting list of each of its trigrams, and it is added
+* to the prefix trie, so the cost only depends on the entry's length.
+*
+* @indexPtr: Pointer to the history index pointer.
+* @entry: The history entry to add.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int history_indexAdd(HistoryIndex **indexPtr, const char *entry)
+{
+	HistoryIndex *index = *indexPtr;
+	HistoryPosting *posting;
+	const unsigned char *text = (const unsigned char *)entry;
+	unsigned int id, key, i;
+	void *grown;
+
+	if (!index)
+	{
+		index = malloc(sizeof(HistoryIndex));
+		if (!index)
+			return (-1);
+		fillMemoryBlock((void *)index, 0, sizeof(HistoryIndex));
+		*indexPtr = index;
+	}
+	if (index->count == index->capacity)
+	{
+		grown = realloc_Memory(index->entries, index->capacity * sizeof(char *),
+			(index->capacity ? index->capacity * 2 : 256) * sizeof(char *));
+		if (!grown)
+			return (-1);
+		index->entries = grown;
+		index->capacity = index->capacity ? index->capacity * 2 : 256;
+	}
+	id = index->count;
+	index->entries[id] = str_duplicate(entry);
+	if (!index->entries[id])
+		return (-1);
+	index->count++;
+	for (i = 0; text[i] && text[i + 1] && text[i + 2]; i++)
+	{
+		key = text[i] << 16 | text[i + 1] << 8 | text[i + 2];
+		posting = history_indexPosting(index, key, 1);
+		if (!posting || history_indexAppend(posting, id) == -1)
+			return (-1);
+	}
+	return (history_indexTrie(index, id));
+}
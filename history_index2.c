@@ -0,0 +1,148 @@
+#include "shell.h"
+
+/**
+* history_indexMatches - function checks an entry against a query.
+*
+* @entry: The history entry.
+* @query: The text searched for.
+* @prefix: 1 if @query must start the entry, 0 if it may appear anywhere.
+*
+* Return: 1 if the entry matches, 0 otherwise.
+*/
+static int history_indexMatches(const char *entry, const char *query,
+								int prefix)
+{
+	size_t i, j;
+
+	if (prefix || !*query)
+		return (checkIfPrefix(entry, query) != NULL);
+	for (i = 0; entry[i]; i++)
+	{
+		for (j = 0; query[j] && entry[i + j] == query[j]; j++)
+			;
+		if (!query[j])
+			return (1);
+	}
+	return (0);
+}
+
+/**
+* history_indexBefore - function counts the ids of a posting list that are
+* smaller than a given id, by binary search.
+*
+* @posting: The posting list, its ids in increasing order.
+* @before: The id.
+*
+* Return: The number of ids smaller than @before.
+*/
+static unsigned int history_indexBefore(const HistoryPosting *posting,
+										int before)
+{
+	unsigned int low = 0, high = posting->count, middle;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (posting->ids[middle] < (unsigned int)before)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return (low);
+}
+
+/**
+* history_indexSearch - function finds the newest entry matching a query.
+*
+* For queries of three characters or more, only the entries listed under
+* the query's rarest trigram are checked, newest first. Shorter queries
+* are checked against every entry, newest first. Dropped entries are
+* never matched.
+*
+* @index: Pointer to the history index.
+* @query: The text searched for.
+* @before: Only entries with an id lower than this are considered;
+* a negative value means all entries.
+* @prefix: 1 if @query must start the entry, 0 if it may appear anywhere.
+*
+* Return: Id of the matching entry, or -1 if there is none.
+*/
+int history_indexSearch(HistoryIndex *index, const char *query,
+						int before, int prefix)
+{
+	const unsigned char *text = (const unsigned char *)query;
+	HistoryPosting *posting, *rarest = NULL;
+	unsigned int low;
+	int id;
+	size_t i;
+
+	if (!index)
+		return (-1);
+	if (before < 0 || (size_t)before > index->count)
+		before = index->count;
+	for (i = 0; text[i] && text[i + 1] && text[i + 2]; i++)
+	{
+		posting = history_indexPosting(index,
+			text[i] << 16 | text[i + 1] << 8 | text[i + 2], 0);
+		if (!posting)
+			return (-1);
+		if (!rarest || posting->count < rarest->count)
+			rarest = posting;
+	}
+	if (!rarest)
+	{
+		for (id = before - 1; id >= (int)index->first; id--)
+			if (history_indexMatches(index->entries[id], query, prefix))
+				return (id);
+		return (-1);
+	}
+
+	/* Find the first posting at or after 'before', then walk back */
+	low = history_indexBefore(rarest, before);
+	while (low-- && rarest->ids[low] >= index->first)
+		if (history_indexMatches(index->entries[rarest->ids[low]],
+								 query, prefix))
+			return (rarest->ids[low]);
+	return (-1);
+}
+
+/**
+* history_indexSuggest - function suggests a completion from the history.
+*
+* The trie gives the newest entry starting with @prefix directly. For a
+* prefix longer than the trie, that entry is confirmed against the whole
+* prefix, falling back to a trigram search if it does not match.
+*
+* @index: Pointer to the history index.
+* @prefix: The text typed so far.
+*
+* Return: The rest of the suggested entry after @prefix, or NULL if there
+* is no entry longer than @prefix starting with it.
+*/
+const char *history_indexSuggest(HistoryIndex *index, const char *prefix)
+{
+	const unsigned char *text = (const unsigned char *)prefix;
+	int node = 0, child, id;
+	size_t depth;
+
+	if (!index || !index->node_count || !*prefix)
+		return (NULL);
+	for (depth = 0; text[depth] && depth < HISTORY_TRIE_DEPTH; depth++)
+	{
+		for (child = index->nodes[node].child; child &&
+			 index->nodes[child].byte != text[depth];
+			 child = index->nodes[child].sibling)
+			;
+		if (!child)
+			return (NULL);
+		node = child;
+	}
+	id = index->nodes[node].latest;
+	if (id < (int)index->first)
+		return (NULL);
+	if (text[depth] && !checkIfPrefix(index->entries[id], prefix))
+		id = history_indexSearch(index, prefix, -1, 1);
+	if (id == -1 || !index->entries[id][str_length((char *)prefix)])
+		return (NULL);
+	return (index->entries[id] + str_length((char *)prefix));
+}
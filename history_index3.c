@@ -0,0 +1,125 @@
+#include "shell.h"
+
+/**
+* history_indexPrune - function copies the part of the prefix trie below a
+* node that still leads to an entry kept.
+*
+* A node whose newest entry was dropped only leads to dropped entries, so
+* it is left out with everything below it.
+*
+* @index: Pointer to the history index, receiving the copy in @kept.
+* @kept: The trie being built.
+* @node: The node to copy, from the old trie.
+*
+* Return: Index of the copy in @kept.
+*/
+static int history_indexPrune(HistoryIndex *index, HistoryTrieNode *kept,
+							  int node)
+{
+	int copy = index->node_count++, child, last = 0;
+
+	kept[copy] = index->nodes[node];
+	kept[copy].latest -= (int)index->first;
+	kept[copy].child = 0;
+	for (child = index->nodes[node].child; child;
+		 child = index->nodes[child].sibling)
+	{
+		if (index->nodes[child].latest < (int)index->first)
+			continue;
+		if (last)
+			last = kept[last].sibling = history_indexPrune(index, kept, child);
+		else
+			last = kept[copy].child = history_indexPrune(index, kept, child);
+		kept[last].sibling = 0;
+	}
+	return (copy);
+}
+
+/**
+* history_indexCompact - function lowers every id by the number of entries
+* dropped, so the entries kept start the index again.
+*
+* Nothing is read again from the entries: the ids are shifted in place in
+* the posting lists, and the trie is copied without its dead branches.
+*
+* @index: Pointer to the history index.
+*/
+static void history_indexCompact(HistoryIndex *index)
+{
+	HistoryTrieNode *kept, *old = index->nodes;
+	HistoryPosting *posting;
+	size_t i, j, k;
+
+	for (i = index->first; i < index->count; i++)
+		index->entries[i - index->first] = index->entries[i];
+	for (i = 0; i < index->posting_capacity; i++)
+	{
+		posting = &index->postings[i];
+		for (j = 0, k = 0; j < posting->count; j++)
+			if (posting->ids[j] >= index->first)
+				posting->ids[k++] = posting->ids[j] - index->first;
+		posting->count = k;
+		if (!k)
+			free(posting->ids), posting->ids = NULL, posting->capacity = 0;
+	}
+	kept = index->node_count ?
+		malloc(sizeof(HistoryTrieNode) * index->node_capacity) : NULL;
+	if (kept)
+	{
+		index->node_count = 0;
+		history_indexPrune(index, kept, 0);
+		index->nodes = kept;
+		free(old);
+	}
+	else
+		for (i = 0; i < index->node_count; i++)
+			index->nodes[i].latest -= (int)index->first;
+	index->count -= index->first;
+	index->first = 0;
+}
+
+/**
+* history_indexDrop - function drops the oldest entries of the index.
+*
+* A dropped entry is only freed; its id goes out of the posting lists and
+* the trie when the index is compacted, once as many entries were dropped
+* as are kept, so dropping costs a constant time per entry on average.
+*
+* @index: Pointer to the history index, or NULL if there is none.
+* @keep: Number of entries to keep, the newest ones.
+*/
+void history_indexDrop(HistoryIndex *index, size_t keep)
+{
+	if (!index)
+		return;
+	while (index->count - index->first > keep)
+	{
+		free(index->entries[index->first]);
+		index->entries[index->first++] = NULL;
+	}
+	if (index->first && index->first >= index->count - index->first)
+		history_indexCompact(index);
+}
+
+/**
+* history_indexFree - function releases the history index.
+*
+* @indexPtr: Pointer to the history index pointer.
+*/
+void history_indexFree(HistoryIndex **indexPtr)
+{
+	HistoryIndex *index = *indexPtr;
+	size_t i;
+
+	if (!index)
+		return;
+	for (i = 0; i < index->count; i++)
+		free(index->entries[i]);
+	for (i = 0; i < index->posting_capacity; i++)
+		free(index->postings[i].ids);
+	free(index->entries);
+	free(index->postings);
+	free(index->nodes);
+	free(index);
+	*indexPtr = NULL;
+}
@@ -43,6 +43,7 @@ char *history_getFile(CommandInfo *information)
 *
 * This function writes the command history stored
 * in the information structure to a file.
+* Nothing is written when the shared history log is in use.
 *
 * @information: Pointer to the command information structure.
 *
@@ -55,12 +56,17 @@ int history_writing(CommandInfo *information)
 
 	StringList *node = NULL;
 
+	/* The shared log is always up to date, there is nothing to rewrite. */
+	if (information->history_log)
+		return (free(file_name), 1);
+
 	/* Step 1: Check if the history file name is valid. */
 	if (!file_name)
 		return (-1);
 
 	/* Step 2: Open the history file for writing. */
-	file_descriptor = open(file_name, O_CREAT | O_TRUNC | O_RDWR, 0644);
+	file_descriptor = open(file_name, O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC,
+						   0644);
 	free(file_name);
 
 	/* Step 3: Check if the file was opened successfully. */
@@ -87,13 +93,29 @@ int history_writing(CommandInfo *information)
 *
 * This function prints the command history
 * from the command information structure.
+* When the shared history log is in use, it is printed directly
+* from the log instead.
 *
 * @information: Pointer to the command information structure.
 * Return: Always returns 0.
 */
 int print_command_history(CommandInfo *information)
 {
+	if (information->history_log)
+		return (history_logPrint(information));
 	printLinkedList(information->command_history);
 	return (0);
 }
 
+/**
+* history_free - function releases the history list, its search index and
+* the shared history log.
+*
+* @information: Pointer to the command information structure.
+*/
+void history_free(CommandInfo *information)
+{
+	freeLinkedList(&(information->command_history));
+	history_indexFree(&(information->history_index));
+	history_logClose(information);
+}
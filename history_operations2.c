@@ -27,7 +27,11 @@ int history_buildList(CommandInfo *information, char *buffer, int line_count)
 	if (!information->command_history)
 		information->command_history = node;
 
-	/* Step 4: Return success. */
+	/* Step 4: Keep the search index of an interactive shell up to date. */
+	if (isInteractiveShell(information))
+		history_indexAdd(&(information->history_index), buffer);
+
+	/* Step 5: Return success. */
 	return (0);
 }
 
@@ -59,6 +63,33 @@ int history_reNumber(CommandInfo *information)
 	return (count);
 }
 
+/**
+* history_parse - function adds each line of a history file to the list.
+*
+* @information: Pointer to the command information structure.
+* @buffer: The contents of the file, cut in place.
+* @file_size: Length of @buffer.
+*
+* Return: Number of lines added.
+*/
+static int history_parse(CommandInfo *information, char *buffer,
+						 ssize_t file_size)
+{
+	int last = 0, line_count = 0;
+	ssize_t i;
+
+	for (i = 0; i < file_size; i++)
+		if (buffer[i] == '\n')
+		{
+			buffer[i] = 0;
+			history_buildList(information, buffer + last, line_count++);
+			last = i + 1;
+		}
+	if (last != i)
+		history_buildList(information, buffer + last, line_count++);
+	return (line_count);
+}
+
 /**
 * history_reading - function read command history from a file.
 *
@@ -70,15 +101,16 @@ int history_reNumber(CommandInfo *information)
 */
 int history_reading(CommandInfo *information)
 {
-	int i, last = 0, line_count = 0;
-
 	ssize_t file_descriptor, read_length, file_size = 0;
 	struct stat file_stat;
-	char *buffer = NULL, *file_name = history_getFile(information);
+	char *buffer = NULL, *file_name = NULL;
 
+	if (history_logOpen(information))
+		return (information->history_count);
+	file_name = history_getFile(information);
 	if (!file_name)
 		return (0);
-	file_descriptor = open(file_name, O_RDONLY);
+	file_descriptor = open(file_name, O_RDONLY | O_CLOEXEC);
 	free(file_name);
 
 	if (file_descriptor == -1)
@@ -95,19 +127,12 @@ int history_reading(CommandInfo *information)
 	if (read_length <= 0)
 		return (free(buffer), close(file_descriptor), 0);
 	close(file_descriptor);
-	for (i = 0; i < file_size; i++)
-		if (buffer[i] == '\n')
-		{
-			buffer[i] = 0;
-			history_buildList(information, buffer + last, line_count++);
-			last = i + 1;
-		}
-	if (last != i)
-		history_buildList(information, buffer + last, line_count++);
+	information->history_count = history_parse(information, buffer,
+												file_size);
 	free(buffer);
-	information->history_count = line_count;
 	while (information->history_count-- >= HISTORY_MAX)
 		deleteNodeAtIndexInList(&(information->command_history), 0);
 	history_reNumber(information);
+	history_indexDrop(information->history_index, information->history_count);
 	return (information->history_count);
 }
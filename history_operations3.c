@@ -0,0 +1,192 @@
+#include "shell.h"
+
+/**
+* history_logOpen - function opens the shared history log if it is enabled.
+*
+* The shared log is used instead of the history file when the
+* HSH_SHARED_HISTORY variable is set. The log lives next to the history
+* file in the user's home directory and is mapped into every session, so
+* commands entered in one session are visible to the others right away.
+* On success the records already in the log are loaded into the history
+* list.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 1 if the shared log is in use, 0 otherwise.
+*/
+int history_logOpen(CommandInfo *information)
+{
+	HistoryLog *log;
+	char *home_directory;
+
+	/* Step 1: The shared log is opt-in. */
+	if (!getEnvironmentVariable(information, "HSH_SHARED_HISTORY="))
+		return (0);
+	home_directory = getEnvironmentVariable(information, "HOME=");
+	if (!home_directory)
+		return (0);
+
+	/* Step 2: Build the path of the log file. */
+	log = malloc(sizeof(HistoryLog));
+	if (!log)
+		return (0);
+	fillMemoryBlock((void *)log, 0, sizeof(HistoryLog));
+	log->descriptor = -1;
+	log->path = malloc(str_length(home_directory) +
+					   str_length(HISTORY_LOG_FILE) + 2);
+	if (!log->path)
+		return (free(log), 0);
+	str_copy(log->path, home_directory);
+	str_concatenate(log->path, "/");
+	str_concatenate(log->path, HISTORY_LOG_FILE);
+
+	/* Step 3: Map the log and load the records it already holds. */
+	if (history_logMap(log) == -1)
+		return (free(log->path), free(log), 0);
+	information->history_log = log;
+	history_logSync(information);
+	return (1);
+}
+
+/**
+* history_logAppend - function appends a command to the shared history log.
+*
+* Space for the record is claimed with a compare-and-swap, so concurrent
+* sessions never block each other, and the record is marked committed
+* only once its text is complete. When the log is full it is rotated and
+* the append is retried once.
+*
+* @information: Pointer to the command information structure.
+* @command: The command text to append.
+*
+* Return: 0 on success, -1 if the command could not be appended.
+*/
+int history_logAppend(CommandInfo *information, char *command)
+{
+	HistoryLog *log = information->history_log;
+	HistoryRecord *record;
+	unsigned long offset, size;
+	int attempt;
+
+	if (!log || !command)
+		return (-1);
+	size = (sizeof(HistoryRecord) + str_length(command) + 8) & ~7UL;
+	if (size > log->header->capacity / 4)
+		return (-1);
+	for (attempt = 0; attempt < 2; attempt++)
+	{
+		offset = history_logClaim(log, size);
+		if (offset)
+		{
+			record = (HistoryRecord *)(log->map + offset);
+			record->length = str_length(command);
+			str_copy((char *)(record + 1), command);
+			__atomic_store_n(&record->state, HISTORY_RECORD_COMMITTED,
+							 __ATOMIC_RELEASE);
+			return (0);
+		}
+		/* Step 2: The log is full, pick up what is left and rotate it. */
+		history_logSync(information);
+		if (history_logRotate(log) == -1)
+			return (-1);
+	}
+	return (-1);
+}
+
+/**
+* history_logSync - function adds records appended by other sessions.
+*
+* Reads the log incrementally from the offset this session has already
+* seen and adds every record written by another session to the history
+* list, dropping the oldest entries past HISTORY_MAX. If the log has been
+* rotated, the new file is mapped and reading continues from the first
+* record appended after the rotation.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: The number of records added to the history list.
+*/
+int history_logSync(CommandInfo *information)
+{
+	HistoryLog *log = information->history_log;
+	HistoryRecord *record;
+	int added = 0, pass;
+
+	if (!log)
+		return (0);
+	for (pass = 0; pass < 2; pass++)
+	{
+		while ((record = history_logNext(log, &(log->seen))))
+		{
+			if (HISTORY_CLAIM_PID(record->claim) == getpid())
+				continue;
+			history_buildList(information, (char *)(record + 1),
+							  information->history_count++);
+			added++;
+		}
+		if (!__atomic_load_n(&log->header->rotated, __ATOMIC_ACQUIRE))
+			break;
+		if (history_logMap(log) == -1)
+		{
+			history_logClose(information);
+			break;
+		}
+	}
+	if (information->history_count > HISTORY_MAX)
+	{
+		while (information->history_count-- > HISTORY_MAX)
+			deleteNodeAtIndexInList(&(information->command_history), 0);
+		history_reNumber(information);
+		history_indexDrop(information->history_index,
+						  information->history_count);
+	}
+	return (added);
+}
+
+/**
+* history_logPrint - function prints the shared history log.
+*
+* Records are printed straight from the shared mapping, without copying
+* them into the history list first.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always returns 0.
+*/
+int history_logPrint(CommandInfo *information)
+{
+	HistoryLog *log = information->history_log;
+	HistoryRecord *record;
+	unsigned long offset = sizeof(HistoryLogHeader);
+	long number = 0;
+
+	while ((record = history_logNext(log, &offset)))
+	{
+		print_str(conver_longInt_str(number++, 10, 0));
+		print_str(": ");
+		print_str((char *)(record + 1));
+		print_char('\n');
+	}
+	return (0);
+}
+
+/**
+* history_logClose - function releases the shared history log.
+*
+* @information: Pointer to the command information structure.
+*/
+void history_logClose(CommandInfo *information)
+{
+	HistoryLog *log = information->history_log;
+
+	if (!log)
+		return;
+	if (log->map)
+		munmap(log->map, log->header->capacity);
+	descriptor_release(&log->descriptor);
+	if (log->descriptor != -1)
+		close(log->descriptor);
+	free(log->path);
+	free(log);
+	information->history_log = NULL;
+}
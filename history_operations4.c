@@ -0,0 +1,243 @@
+#include "shell.h"
+
+/**
+* history_logMap - function maps the shared history log into memory.
+*
+* Opens (creating if needed) the log file, sizes it and maps it shared.
+* A new file is initialised under an exclusive file lock so that two
+* sessions starting at the same time do not both write the header.
+* If the log was already mapped, the old mapping is released and reading
+* resumes from the first record appended after the last rotation.
+*
+* @log: Pointer to the shared history log.
+*
+* Return: 0 on success, -1 on failure.
+*/
+int history_logMap(HistoryLog *log)
+{
+	struct stat file_stat;
+	int remap = log->map != NULL, descriptor;
+	char *map;
+
+	descriptor = open(log->path, O_CREAT | O_RDWR | O_CLOEXEC, 0600);
+	if (descriptor == -1)
+		return (-1);
+	flock(descriptor, LOCK_EX);
+	if (fstat(descriptor, &file_stat) == -1 || (file_stat.st_size == 0 &&
+		ftruncate(descriptor, HISTORY_LOG_SIZE) == -1))
+		return (flock(descriptor, LOCK_UN), close(descriptor), -1);
+	if (file_stat.st_size == 0)
+		file_stat.st_size = HISTORY_LOG_SIZE;
+	map = mmap(NULL, file_stat.st_size, PROT_READ | PROT_WRITE,
+			   MAP_SHARED, descriptor, 0);
+	if (map == MAP_FAILED)
+		return (flock(descriptor, LOCK_UN), close(descriptor), -1);
+	if (((HistoryLogHeader *)map)->magic != HISTORY_LOG_MAGIC)
+	{
+		((HistoryLogHeader *)map)->capacity = file_stat.st_size;
+		((HistoryLogHeader *)map)->tail = sizeof(HistoryLogHeader);
+		((HistoryLogHeader *)map)->base = sizeof(HistoryLogHeader);
+		((HistoryLogHeader *)map)->magic = HISTORY_LOG_MAGIC;
+	}
+	flock(descriptor, LOCK_UN);
+
+	/* Step 2: Drop the previous mapping, if any. */
+	if (remap)
+	{
+		munmap(log->map, log->header->capacity);
+		close(log->descriptor);
+	}
+	log->descriptor = descriptor;
+	descriptor_keep(&log->descriptor);
+	log->map = map;
+	log->header = (HistoryLogHeader *)map;
+	log->seen = remap ? log->header->base : sizeof(HistoryLogHeader);
+	return (0);
+}
+
+/**
+* history_logNext - function returns the next committed record of the log.
+*
+* Walks the log from @offset and returns the next record whose text is
+* complete, advancing @offset past it. Reading stops at a record that is
+* still being written. A record that was reserved by a session which
+* died before committing it is skipped, as is the space left unused when
+* the log was rotated.
+*
+* @log: Pointer to the shared history log.
+* @offset: Pointer to the offset to read from, updated on success.
+*
+* Return: Pointer to the record, or NULL if no complete record is ready.
+*/
+HistoryRecord *history_logNext(HistoryLog *log, unsigned long *offset)
+{
+	HistoryRecord *record;
+	unsigned long tail, claim, size;
+	int pid;
+
+	if (!log)
+		return (NULL);
+	tail = __atomic_load_n(&log->header->tail, __ATOMIC_ACQUIRE);
+	while (*offset + sizeof(HistoryRecord) <= tail)
+	{
+		record = (HistoryRecord *)(log->map + *offset);
+		claim = __atomic_load_n(&record->claim, __ATOMIC_ACQUIRE);
+		size = HISTORY_CLAIM_SIZE(claim), pid = HISTORY_CLAIM_PID(claim);
+		if (size < sizeof(HistoryRecord) || *offset + size > tail)
+			return (NULL);
+		*offset += size;
+		if (__atomic_load_n(&record->state, __ATOMIC_ACQUIRE) ==
+			HISTORY_RECORD_COMMITTED)
+			return (record);
+		if (pid && !(kill(pid, 0) == -1 && errno == ESRCH))
+		{
+			*offset -= size;
+			return (NULL);
+		}
+	}
+	return (NULL);
+}
+
+/**
+* history_logClaim - function reserves space at the tail of the log.
+*
+* The record at the tail is claimed first, its size and the pid of the
+* session stored together with one compare-and-swap, and the tail is then
+* moved past it. A session finding a record claimed but the tail not moved
+* yet moves it itself, so a session dying in between stalls nobody, and a
+* reader never finds a record without its size.
+*
+* @log: Pointer to the shared history log.
+* @size: Size of the record, or 0 to claim all the space left, which
+* closes the log to new records.
+*
+* Return: Offset of the record claimed, 0 if the log is full.
+*/
+unsigned long history_logClaim(HistoryLog *log, unsigned long size)
+{
+	HistoryRecord *record;
+	unsigned long tail, claim, free_claim, capacity = log->header->capacity;
+	int claimed;
+
+	for (;;)
+	{
+		tail = __atomic_load_n(&log->header->tail, __ATOMIC_ACQUIRE);
+		if (tail + (size ? size : sizeof(HistoryRecord)) > capacity)
+			return (0);
+		record = (HistoryRecord *)(log->map + tail);
+		claim = size ? HISTORY_CLAIM(size, getpid()) :
+				HISTORY_CLAIM(capacity - tail, 0);
+		free_claim = 0;
+		claimed = __atomic_compare_exchange_n(&record->claim, &free_claim,
+			claim, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+		if (!claimed)
+			claim = free_claim;
+		__atomic_compare_exchange_n(&log->header->tail, &tail,
+			tail + HISTORY_CLAIM_SIZE(claim), 0, __ATOMIC_ACQ_REL,
+			__ATOMIC_ACQUIRE);
+		if (claimed)
+			return ((char *)record - log->map);
+	}
+}
+
+/**
+* history_logCopy - function closes a full log and writes its newest
+* records into a fresh log file.
+*
+* The space left in the old log is claimed first, so no session reserves
+* a record there once the copy is made. Records still being written are
+* waited for, up to HISTORY_LOG_WAIT milliseconds each, then only the
+* committed records from the second half of the old log are kept, so a
+* rotated log starts half empty.
+*
+* @log: Pointer to the shared history log being rotated.
+* @descriptor: File descriptor of the new, empty log file.
+*
+* Return: 0 on success, -1 on failure.
+*/
+static int history_logCopy(HistoryLog *log, int descriptor)
+{
+	HistoryLogHeader *header;
+	HistoryRecord *record;
+	unsigned long offset, end, keep, size, i;
+	int pid, wait;
+	char *map;
+
+	if (ftruncate(descriptor, log->header->capacity) == -1)
+		return (-1);
+	map = mmap(NULL, log->header->capacity, PROT_READ | PROT_WRITE,
+			   MAP_SHARED, descriptor, 0);
+	if (map == MAP_FAILED)
+		return (-1);
+	end = history_logClaim(log, 0);
+	if (!end)
+		end = __atomic_load_n(&log->header->tail, __ATOMIC_ACQUIRE);
+	header = (HistoryLogHeader *)map;
+	header->capacity = log->header->capacity;
+	header->tail = sizeof(HistoryLogHeader);
+	keep = end > header->capacity / 2 ? end - header->capacity / 2 : 0;
+	for (offset = sizeof(HistoryLogHeader); offset < end; offset += size)
+	{
+		record = (HistoryRecord *)(log->map + offset);
+		size = HISTORY_CLAIM_SIZE(record->claim);
+		pid = HISTORY_CLAIM_PID(record->claim);
+		for (wait = 0; wait < HISTORY_LOG_WAIT && pid &&
+			 __atomic_load_n(&record->state, __ATOMIC_ACQUIRE) !=
+			 HISTORY_RECORD_COMMITTED && kill(pid, 0) == 0; wait++)
+			usleep(1000);
+		if (size < sizeof(HistoryRecord))
+			break;
+		if (offset < keep || record->state != HISTORY_RECORD_COMMITTED)
+			continue;
+		for (i = 0; i < size; i++)
+			map[header->tail + i] = ((char *)record)[i];
+		header->tail += size;
+	}
+	header->base = header->tail;
+	header->magic = HISTORY_LOG_MAGIC;
+	munmap(map, header->capacity);
+	return (0);
+}
+
+/**
+* history_logRotate - function replaces a full log with a fresh one.
+*
+* The newest records are copied into a temporary file which is then
+* renamed over the log. The old log is flagged as rotated so that other
+* sessions notice and map the new file. Rotation happens under the old
+* file's lock; a session that finds the log already rotated simply maps
+* the new file.
+*
+* @log: Pointer to the shared history log.
+*
+* Return: 0 on success, -1 on failure.
+*/
+int history_logRotate(HistoryLog *log)
+{
+	char *temporary;
+	int descriptor, result = 0;
+
+	flock(log->descriptor, LOCK_EX);
+	if (!__atomic_load_n(&log->header->rotated, __ATOMIC_ACQUIRE))
+	{
+		temporary = malloc(str_length(log->path) + 5);
+		if (!temporary)
+			return (flock(log->descriptor, LOCK_UN), -1);
+		str_copy(temporary, log->path);
+		str_concatenate(temporary, ".new");
+		descriptor = open(temporary, O_CREAT | O_TRUNC | O_RDWR | O_CLOEXEC,
+						  0600);
+		if (descriptor == -1 || history_logCopy(log, descriptor) == -1 ||
+			rename(temporary, log->path) == -1)
+			result = -1;
+		else
+			__atomic_store_n(&log->header->rotated, 1, __ATOMIC_RELEASE);
+		if (descriptor != -1)
+			close(descriptor);
+		free(temporary);
+	}
+	flock(log->descriptor, LOCK_UN);
+	if (result == -1)
+		return (-1);
+	return (history_logMap(log));
+}
@@ -1,5 +1,60 @@
 #include "shell.h"
 
+/**
+ * information_split - function splits the command into its words.
+ *
+ * The words are split keeping $((...)) whole; if that fails, the whole
+ * command is taken as one word.
+ *
+ * @information: Pointer to the command information structure.
+ */
+static void information_split(CommandInfo *information)
+{
+	int argumentCount;
+
+	information->arguments_array = syntax_split(information->argument);
+	if (!information->arguments_array)
+	{
+		information->arguments_array = malloc(sizeof(char *) * 2);
+		if (information->arguments_array)
+		{
+			information->arguments_array[0] = str_duplicate(information->argument);
+			information->arguments_array[1] = NULL;
+		}
+	}
+
+	/* Count the number of arguments in the vector. */
+	for (argumentCount = 0; information->arguments_array &&
+							information->arguments_array[argumentCount];
+		 argumentCount++)
+		;
+	information->argument_count = argumentCount;
+}
+
+/**
+ * information_expand - function replaces variables, then glob patterns by
+ * the paths they match.
+ *
+ * A failed expansion drops the command. Bare assignments are expanded one
+ * by one as they are assigned, and compound commands expand their parts
+ * as they run them.
+ *
+ * @information: Pointer to the command information structure.
+ */
+static void information_expand(CommandInfo *information)
+{
+	information->assignments = variable_prefix(information->arguments_array);
+	if (information->assignments != information->argument_count &&
+		information->arguments_array &&
+		!syntax_compound(information->arguments_array[0]) &&
+		(variables_replacer(information) || glob_replacer(information)))
+	{
+		freeStringArray(information->arguments_array);
+		information->arguments_array = NULL;
+		information->argument_count = 0;
+	}
+}
+
 /**
  * information_setter - function sts fields in the command
  * information structure based on provided arguments.
@@ -14,7 +69,7 @@
 
 void information_setter(CommandInfo *information, char **arguments)
 {
-	int argumentCount = 0;
+	unsigned long start = trace_begin();
 
 	/* Step 1: Set the executable name. */
 	information->file_name = arguments[0];
@@ -22,35 +77,18 @@ void information_setter(CommandInfo *information, char **arguments)
 	/* Step 2: Process and set the argument vector. */
 	if (information->argument)
 	{
-		/* Attempt to split the argument string into an argument vector. */
-		information->arguments_array = tokenizeString(information->argument, " \t");
-
-		/* If the argument vector is not successfully created, */
-		/* allocate and set it manually. */
-		if (!information->arguments_array)
-		{
-			information->arguments_array = malloc(sizeof(char *) * 2);
-			if (information->arguments_array)
-			{
-				information->arguments_array[0] = str_duplicate(information->argument);
-				information->arguments_array[1] = NULL;
-			}
-		}
-
-		/* Count the number of arguments in the vector. */
-		for (argumentCount = 0; information->arguments_array &&
-								information->arguments_array[argumentCount];
-			 argumentCount++)
-			;
-
-		/* Set the argument count in the structure. */
-		information->argument_count = argumentCount;
+		information_split(information);
+		trace_end(TRACE_TOKENIZE, start, information->current_line);
 
 		/* Step 3: Replace aliases in the argument vector. */
+		start = trace_begin();
 		alias_replacer(information);
+		trace_end(TRACE_ALIAS, start, information->current_line);
 
-		/* Step 4: Replace variables in the argument vector. */
-		variables_replacer(information);
+		/* Step 4: Replace variables and glob patterns. */
+		start = trace_begin();
+		information_expand(information);
+		trace_end(TRACE_EXPAND, start, information->current_line);
 	}
 }
 
@@ -91,10 +129,12 @@ void information_clear(CommandInfo *information)
  */
 void information_free(CommandInfo *information, int all)
 {
-	/* Step 1: Free the argument vector. */
+	/* Step 1: Free the argument vector and the environment overlay. */
 	freeStringArray(information->arguments_array);
 	information->arguments_array = NULL;
 	information->executable_path = NULL;
+	freeStringArray(information->overlay);
+	information->overlay = NULL;
 
 	/* Step 2: Free additional resources if the 'all' flag is set. */
 	if (all)
@@ -103,21 +143,20 @@ void information_free(CommandInfo *information, int all)
 		if (!information->command_buffer)
 			free(information->argument);
 
-		/* Free the environment variable list. */
-		if (information->environment_list)
-			freeLinkedList(&(information->environment_list));
-
-		/* Free the history list. */
-		if (information->command_history)
-			freeLinkedList(&(information->command_history));
+		/* Each part of the shell releases what it holds. */
+		environment_free(information);
+		history_free(information);
+		editor_free(information);
+		completion_invalidate(information);
+		arith_free(information);
+		case_free(information);
+		regex_free(information);
+		executable_free(information);
+		variable_free(information);
+		time_free(information);
 
 		/* Free the alias list. */
-		if (information->command_alias)
-			freeLinkedList(&(information->command_alias));
-
-		/* Free the environment variables array. */
-		freeStringArray(information->environment_variables);
-		information->environment_variables = NULL;
+		freeLinkedList(&(information->command_alias));
 
 		/* Free the command buffer list. */
 		freeAndSetNull((void **)information->command_buffer);
@@ -114,6 +114,7 @@ int isCommand(CommandInfo *information, char *path)
 	struct stat fileStat;
 
 	(void)information;
+	shell_counters[COUNTER_STATS] += path != NULL;
 	/* Step 1: Check if the path is valid or if stat fails */
 	if (!path || stat(path, &fileStat))
 		return (0);
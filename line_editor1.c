@@ -0,0 +1,184 @@
+#include "shell.h"
+
+/**
+* editor_isAvailable - function checks if the line editor can be used.
+*
+* The editor is only used by an interactive shell whose output also goes
+* to a terminal that understands cursor movement.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 1 if the line editor can be used, 0 otherwise.
+*/
+int editor_isAvailable(CommandInfo *information)
+{
+	char *terminal = getEnvironmentVariable(information, "TERM=");
+
+	if (!isInteractiveShell(information) || !isatty(STDOUT_FILENO))
+		return (0);
+	if (terminal && !str_compare(terminal, "dumb"))
+		return (0);
+	return (1);
+}
+
+/**
+* editor_begin - function prepares the editor for a new line.
+*
+* The prompt has already been printed by the shell, so it is recorded as
+* being on screen and only the line itself needs drawing.
+*
+* @editor: Pointer to the line editor.
+* @prompt: The prompt printed.
+*/
+static void editor_begin(LineEditor *editor, const char *prompt)
+{
+	struct winsize window;
+
+	editor->line.length = 0;
+	builder_append(&editor->line, "", 0);
+	editor->cursor = 0;
+	editor->shell_prompt = prompt;
+	editor->shown.length = 0;
+	builder_append(&editor->shown, prompt, str_length((char *)prompt));
+	editor->shown_cursor = editor->shown.length;
+	editor->history_index = -1;
+	editor->escape_state = 0;
+	editor->search_mode = 0;
+	editor->suggestion = NULL;
+	editor->columns = 80;
+	if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &window) == 0 && window.ws_col)
+		editor->columns = window.ws_col;
+}
+
+/**
+* editor_feed - function reads input and applies every key it contains.
+*
+* All the bytes returned by one read are applied before the line is
+* drawn, so pasted text or keys that piled up on a slow link cost a
+* single redraw and a single write. Bytes left over after the end of the
+* line are kept for the next line.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+*
+* Return: 0 to keep editing, 1 when the line is complete,
+* -1 on end of input.
+*/
+static int editor_feed(CommandInfo *information, LineEditor *editor)
+{
+	char chunk[BUFFER_RD];
+	ssize_t count;
+	int status = 0;
+
+	/* Step 1: Refill the pending input when it has all been used */
+	if (editor->pending_index >= editor->pending.length)
+	{
+		editor->pending.length = editor->pending_index = 0;
+		count = read(information->file_descriptor, chunk, BUFFER_RD);
+		if (count == -1 && errno == EINTR)
+			return (0);
+		if (count <= 0)
+			return (-1);
+		shell_counters[COUNTER_BYTES_READ] += count;
+		builder_append(&editor->pending, chunk, count);
+	}
+
+	/* Step 2: Apply the keys, stopping at the end of the line */
+	while (!status && editor->pending_index < editor->pending.length)
+		status = editor_processByte(information, editor,
+			(unsigned char)editor->pending.data[editor->pending_index++]);
+
+	/* Step 3: Draw the result and send it in a single write */
+	if (status == 1)
+		editor->cursor = editor->line.length;
+	editor_prompt(editor);
+	editor_suggest(information, editor);
+	if (status == 1)
+		editor->suggestion = NULL;
+	if (status != -1)
+		editor_render(editor);
+	if (status == 1)
+		builder_append(&editor->output, "\r\n", 2);
+	if (editor->output.length)
+		write(STDOUT_FILENO, editor->output.data, editor->output.length);
+	editor->output.length = 0;
+	return (status);
+}
+
+/**
+* editor_readLine - function reads a line with the interactive editor.
+*
+* Switches the terminal to raw mode, edits the line until Enter is
+* pressed and restores the terminal. Like custom_getline, the line is
+* returned with its trailing newline.
+*
+* @information: Pointer to the command information structure.
+* @buffer: A pointer to the buffer that will store the line.
+* @buffer_size: A pointer to the size of the buffer.
+* @prompt: The prompt the shell printed before the line.
+*
+* Return: The number of characters read on success, -1 on end of input.
+*/
+ssize_t editor_readLine(CommandInfo *information, char **buffer,
+						size_t *buffer_size, const char *prompt)
+{
+	LineEditor *editor = information->line_editor;
+	struct termios raw;
+	int status = 0;
+
+	if (!editor)
+	{
+		editor = malloc(sizeof(LineEditor));
+		if (!editor)
+			return (custom_getline(information, buffer, buffer_size));
+		fillMemoryBlock((void *)editor, 0, sizeof(LineEditor));
+		information->line_editor = editor;
+	}
+	if (tcgetattr(STDIN_FILENO, &editor->original) == -1)
+		return (custom_getline(information, buffer, buffer_size));
+	raw = editor->original;
+	raw.c_iflag &= ~(BRKINT | ICRNL | INPCK | ISTRIP | IXON);
+	raw.c_oflag &= ~(OPOST);
+	raw.c_cflag |= CS8;
+	raw.c_lflag &= ~(ECHO | ICANON | IEXTEN | ISIG);
+	raw.c_cc[VMIN] = 1;
+	raw.c_cc[VTIME] = 0;
+	tcsetattr(STDIN_FILENO, TCSADRAIN, &raw);
+	editor_begin(editor, prompt);
+	while (!status)
+		status = editor_feed(information, editor);
+	tcsetattr(STDIN_FILENO, TCSADRAIN, &editor->original);
+	if (status == -1)
+		return (-1);
+	*buffer = malloc(editor->line.length + 2);
+	if (!*buffer)
+		return (-1);
+	str_copy(*buffer, editor->line.data);
+	str_concatenate(*buffer, "\n");
+	*buffer_size = editor->line.length + 1;
+	return (*buffer_size);
+}
+
+/**
+* editor_free - function releases the line editor.
+*
+* @information: Pointer to the command information structure.
+*/
+void editor_free(CommandInfo *information)
+{
+	LineEditor *editor = information->line_editor;
+
+	if (!editor)
+		return;
+	free(editor->line.data);
+	free(editor->shown.data);
+	free(editor->target.data);
+	free(editor->output.data);
+	free(editor->yank.data);
+	free(editor->saved.data);
+	free(editor->pending.data);
+	free(editor->prompt.data);
+	free(editor->query.data);
+	free(editor);
+	information->line_editor = NULL;
+}
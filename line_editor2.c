@@ -0,0 +1,195 @@
+#include "shell.h"
+
+/**
+* editor_escapeKey - function maps the final byte of an escape sequence
+* to a key.
+*
+* @byte: Final byte of the sequence.
+* @number: Numeric parameter of the sequence, 0 if none.
+* @modified: 1 if the sequence carried a modifier (e.g. Ctrl-Left).
+*
+* Return: The decoded key, or -1 if the sequence is not recognised.
+*/
+static int editor_escapeKey(unsigned char byte, int number, int modified)
+{
+	if (byte == 'A')
+		return (KEY_UP);
+	if (byte == 'B')
+		return (KEY_DOWN);
+	if (byte == 'C')
+		return (modified ? KEY_WORD_RIGHT : KEY_RIGHT);
+	if (byte == 'D')
+		return (modified ? KEY_WORD_LEFT : KEY_LEFT);
+	if (byte == 'H' || (byte == '~' && (number == 1 || number == 7)))
+		return (KEY_HOME);
+	if (byte == 'F' || (byte == '~' && (number == 4 || number == 8)))
+		return (KEY_END);
+	if (byte == '~' && number == 3)
+		return (KEY_DELETE);
+	return (-1);
+}
+
+/**
+* editor_processByte - function decodes one byte of terminal input.
+*
+* Plain bytes are passed straight to editor_processKey. Escape sequences
+* (ESC [ ..., ESC O ... and the Alt-b/Alt-f word motions) are collected
+* across calls, so a sequence split between two reads is still decoded.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @byte: The input byte.
+*
+* Return: The result of editor_processKey, or 0 inside a sequence.
+*/
+int editor_processByte(CommandInfo *information,
+					   LineEditor *editor, unsigned char byte)
+{
+	int key = -1, state = editor->escape_state;
+
+	if (state == 0 && byte != 27)
+		return (editor_processKey(information, editor, byte));
+	editor->escape_state = 0;
+	if (state == 0)
+		editor->escape_state = 1;
+	else if (state == 1 && (byte == '[' || byte == 'O'))
+	{
+		editor->escape_state = byte == '[' ? 2 : 3;
+		editor->escape_number = 0;
+	}
+	else if (state == 1 && (byte == 'b' || byte == 'f'))
+		key = byte == 'b' ? KEY_WORD_LEFT : KEY_WORD_RIGHT;
+	else if ((state == 2 || state == 4) && byte >= '0' && byte <= '9')
+	{
+		editor->escape_state = state;
+		if (state == 2)
+			editor->escape_number = editor->escape_number * 10 + byte - '0';
+	}
+	else if ((state == 2 || state == 4) && byte == ';')
+		editor->escape_state = 4;
+	else if (state > 1)
+		key = editor_escapeKey(byte, editor->escape_number, state == 4);
+	return (key == -1 ? 0 : editor_processKey(information, editor, key));
+}
+
+/**
+* editor_editKey - function applies the keys that change the line.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @key: The decoded key.
+*
+* Return: 1 if the key was handled, 0 otherwise.
+*/
+static int editor_editKey(CommandInfo *information, LineEditor *editor,
+						  int key)
+{
+	size_t next = editor_step(editor, editor->cursor, 1);
+	size_t previous = editor_step(editor, editor->cursor, -1);
+
+	if (key == 127 || key == KEY_CONTROL('h'))
+	{
+		builder_erase(&editor->line, previous, editor->cursor - previous);
+		editor->cursor = previous;
+	}
+	else if (key == KEY_DELETE || key == KEY_CONTROL('d'))
+		builder_erase(&editor->line, editor->cursor, next - editor->cursor);
+	else if (key == KEY_CONTROL('k'))
+		editor_kill(editor, editor->cursor, editor->line.length);
+	else if (key == KEY_CONTROL('u'))
+		editor_kill(editor, 0, editor->cursor);
+	else if (key == KEY_CONTROL('w'))
+		editor_kill(editor, editor_word(editor, editor->cursor, -1),
+					editor->cursor);
+	else if (key == KEY_CONTROL('y'))
+		editor_insert(editor, editor->yank.data, editor->yank.length);
+	else if (key == KEY_UP || key == KEY_CONTROL('p'))
+		editor_recall(information, editor, -1);
+	else if (key == KEY_DOWN || key == KEY_CONTROL('n'))
+		editor_recall(information, editor, 1);
+	else
+		return (0);
+	return (1);
+}
+
+/**
+* editor_screenKey - function applies Ctrl-C and Ctrl-L.
+*
+* Ctrl-C abandons the line and starts a new one under it, Ctrl-L clears
+* the screen. Either way nothing is left on screen that the renderer
+* knows about, so the next render draws the prompt and line in full.
+*
+* @editor: Pointer to the line editor.
+* @key: The decoded key.
+*/
+static void editor_screenKey(LineEditor *editor, int key)
+{
+	if (key == KEY_CONTROL('c'))
+	{
+		editor_moveTo(editor,
+					  editor_width(editor->shown.data, editor->shown_cursor),
+					  editor_width(editor->shown.data, editor->shown.length));
+		builder_append(&editor->output, "^C\r\n", 4);
+		builder_erase(&editor->line, 0, editor->line.length);
+		editor->cursor = 0;
+		editor->history_index = -1;
+	}
+	else
+		builder_append(&editor->output, "\033[H\033[2J", 7);
+	editor->shown.length = 0;
+	editor->shown.data[0] = '\0';
+	editor->shown_cursor = 0;
+}
+
+/**
+* editor_processKey - function applies one key to the line being edited.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @key: The decoded key.
+*
+* Keys are first offered to the Ctrl-R search. Right arrow at the end of
+* the line accepts the suggestion drawn after it.
+*
+* Return: 1 when Enter completes the line, -1 when Ctrl-D is pressed on
+* an empty line, 0 otherwise.
+*/
+int editor_processKey(CommandInfo *information, LineEditor *editor, int key)
+{
+	int status = editor_searchKey(information, editor, key);
+
+	if (status != -2)
+		return (status);
+	if (key == '\r' || key == '\n')
+		return (1);
+	if (key == KEY_CONTROL('d') && !editor->line.length)
+		return (-1);
+	if (key == KEY_HOME || key == KEY_CONTROL('a'))
+		editor->cursor = 0;
+	else if (key == KEY_END || key == KEY_CONTROL('e'))
+		editor->cursor = editor->line.length;
+	else if (key == KEY_LEFT || key == KEY_CONTROL('b'))
+		editor->cursor = editor_step(editor, editor->cursor, -1);
+	else if ((key == KEY_RIGHT || key == KEY_CONTROL('f')) &&
+			 editor->suggestion && editor->cursor == editor->line.length)
+		editor_insert(editor, editor->suggestion,
+					  str_length((char *)editor->suggestion));
+	else if (key == KEY_RIGHT || key == KEY_CONTROL('f'))
+		editor->cursor = editor_step(editor, editor->cursor, 1);
+	else if (key == KEY_WORD_LEFT || key == KEY_WORD_RIGHT)
+		editor->cursor = editor_word(editor, editor->cursor,
+									 key == KEY_WORD_LEFT ? -1 : 1);
+	else if (key == KEY_CONTROL('c') || key == KEY_CONTROL('l'))
+		editor_screenKey(editor, key);
+	else if (key == '\t')
+		editor_complete(information, editor);
+	else if (editor_editKey(information, editor, key))
+		return (0);
+	else if (key >= ' ' && key < 256 && key != 127)
+	{
+		char character = (char)key;
+
+		editor_insert(editor, &character, 1);
+	}
+	return (0);
+}
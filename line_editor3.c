@@ -0,0 +1,102 @@
+#include "shell.h"
+
+/**
+* editor_insert - function inserts text at the cursor.
+*
+* @editor: Pointer to the line editor.
+* @text: The characters to insert.
+* @length: Number of characters to insert.
+*/
+void editor_insert(LineEditor *editor, const char *text, size_t length)
+{
+	if (!length || builder_insert(&editor->line, editor->cursor,
+								  text, length) == -1)
+		return;
+	editor->cursor += length;
+}
+
+/**
+* editor_kill - function removes part of the line into the yank buffer.
+*
+* The removed text replaces the previous content of the yank buffer and
+* can be inserted back with Ctrl-Y.
+*
+* @editor: Pointer to the line editor.
+* @from: Index of the first character to remove.
+* @to: Index one past the last character to remove.
+*/
+void editor_kill(LineEditor *editor, size_t from, size_t to)
+{
+	if (to <= from)
+		return;
+	editor->yank.length = 0;
+	builder_append(&editor->yank, editor->line.data + from, to - from);
+	builder_erase(&editor->line, from, to - from);
+	editor->cursor = from;
+}
+
+/**
+* editor_step - function moves a position by one character.
+*
+* UTF-8 continuation bytes are stepped over, so the cursor never lands in
+* the middle of a multi-byte character.
+*
+* @editor: Pointer to the line editor.
+* @position: The position to move from.
+* @direction: -1 to move left, 1 to move right.
+*
+* Return: The new position.
+*/
+size_t editor_step(LineEditor *editor, size_t position, int direction)
+{
+	char *line = editor->line.data;
+
+	if (direction < 0)
+	{
+		if (!position)
+			return (0);
+		position--;
+		while (position && (line[position] & 0xC0) == 0x80)
+			position--;
+		return (position);
+	}
+	if (position >= editor->line.length)
+		return (editor->line.length);
+	position++;
+	while (position < editor->line.length && (line[position] & 0xC0) == 0x80)
+		position++;
+	return (position);
+}
+
+/**
+* editor_word - function moves a position by one word.
+*
+* Moving left stops at the start of the previous word, moving right stops
+* at the end of the next one. Words are separated by blanks.
+*
+* @editor: Pointer to the line editor.
+* @position: The position to move from.
+* @direction: -1 to move left, 1 to move right.
+*
+* Return: The new position.
+*/
+size_t editor_word(LineEditor *editor, size_t position, int direction)
+{
+	char *line = editor->line.data;
+
+	if (direction < 0)
+	{
+		while (position && IfInDelimiterSet(line[position - 1], " \t"))
+			position--;
+		while (position && !IfInDelimiterSet(line[position - 1], " \t"))
+			position--;
+		return (position);
+	}
+	while (position < editor->line.length &&
+		   IfInDelimiterSet(line[position], " \t"))
+		position++;
+	while (position < editor->line.length &&
+		   !IfInDelimiterSet(line[position], " \t"))
+		position++;
+	return (position);
+}
@@ -0,0 +1,183 @@
+#include "shell.h"
+
+/**
+* editor_recall - function replaces the line with a history entry.
+*
+* Moving up from the line being typed saves it; moving back down past the
+* newest entry restores it.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @direction: -1 for an older entry, 1 for a newer one.
+*/
+void editor_recall(CommandInfo *information, LineEditor *editor,
+				   int direction)
+{
+	StringList *node = information->command_history;
+	int count = getLinkedListLength(node), index;
+
+	index = editor->history_index == -1 ? count : editor->history_index;
+	index += direction;
+	if (index < 0 || index > count)
+		return;
+
+	/* Step 1: Keep the line being typed before leaving it */
+	if (editor->history_index == -1)
+	{
+		editor->saved.length = 0;
+		builder_append(&editor->saved, editor->line.data, editor->line.length);
+	}
+
+	/* Step 2: Load the entry, or the saved line past the newest entry */
+	editor->line.length = 0;
+	editor->history_index = index == count ? -1 : index;
+	if (index == count)
+		builder_append(&editor->line, editor->saved.data,
+					   editor->saved.length);
+	else
+	{
+		while (index--)
+			node = node->next;
+		builder_append(&editor->line, node->string, str_length(node->string));
+	}
+	editor->cursor = editor->line.length;
+}
+
+/**
+* editor_width - function counts the terminal columns used by some text.
+*
+* Every character takes one column; UTF-8 continuation bytes and escape
+* sequences take none.
+*
+* @text: The text to measure.
+* @length: Number of bytes of @text to measure.
+*
+* Return: The number of columns.
+*/
+size_t editor_width(const char *text, size_t length)
+{
+	size_t columns = 0, i;
+
+	for (i = 0; i < length; i++)
+		if (text[i] == '\033')
+		{
+			while (i + 1 < length && !(text[i + 1] >= '@' && text[i + 1] <= '~'
+				   && text[i + 1] != '['))
+				i++;
+			i++;
+		}
+		else if ((text[i] & 0xC0) != 0x80)
+			columns++;
+	return (columns);
+}
+
+/**
+* editor_moveTo - function queues the escape sequences moving the cursor.
+*
+* Positions are counted in columns from the start of the prompt, so a
+* long line that wraps over several rows is handled as well.
+*
+* @editor: Pointer to the line editor.
+* @from: Current cursor position.
+* @to: Wanted cursor position.
+*/
+void editor_moveTo(LineEditor *editor, size_t from, size_t to)
+{
+	size_t from_row = from / editor->columns, to_row = to / editor->columns;
+	size_t from_column = from % editor->columns;
+	size_t to_column = to % editor->columns;
+	char *count;
+
+	if (from_row != to_row)
+	{
+		count = conver_longInt_str(from_row > to_row ? from_row - to_row :
+								   to_row - from_row, 10, 0);
+		builder_append(&editor->output, "\033[", 2);
+		builder_append(&editor->output, count, str_length(count));
+		builder_appendChar(&editor->output, from_row > to_row ? 'A' : 'B');
+	}
+	if (from_column != to_column)
+	{
+		count = conver_longInt_str(from_column > to_column ?
+								   from_column - to_column :
+								   to_column - from_column, 10, 0);
+		builder_append(&editor->output, "\033[", 2);
+		builder_append(&editor->output, count, str_length(count));
+		builder_appendChar(&editor->output,
+						   from_column > to_column ? 'D' : 'C');
+	}
+}
+
+/**
+* editor_compose - function writes the text to show into the target
+* buffer: the prompt, the line, then the dimmed suggestion.
+*
+* @editor: Pointer to the line editor.
+*
+* Return: Length of the prompt and the line, where the suggestion starts.
+*/
+static size_t editor_compose(LineEditor *editor)
+{
+	StringBuilder *target = &editor->target;
+	size_t end;
+
+	target->length = 0;
+	builder_append(target, editor->prompt.data, editor->prompt.length);
+	builder_append(target, editor->line.data, editor->line.length);
+	end = target->length;
+	if (editor->suggestion)
+	{
+		builder_append(target, "\033[2m", 4);
+		builder_append(target, editor->suggestion,
+					   str_length((char *)editor->suggestion));
+		builder_append(target, "\033[0m", 4);
+	}
+	return (end);
+}
+
+/**
+* editor_render - function brings the screen up to date with the line.
+*
+* The text to show (prompt, line, then the dimmed suggestion) is compared
+* with what is already on screen. Only the part after the longest common
+* prefix is rewritten, anything left over from a longer line is erased,
+* and the cursor is put back in place. The sequences are queued in the
+* output buffer, to be sent with a single write.
+*
+* @editor: Pointer to the line editor.
+*/
+void editor_render(LineEditor *editor)
+{
+	StringBuilder *target = &editor->target, *shown = &editor->shown;
+	StringBuilder swap;
+	size_t common = 0, end, cursor = editor->prompt.length;
+
+	end = editor_compose(editor);
+	cursor += editor->cursor;
+	while (common < target->length && common < shown->length &&
+		   target->data[common] == shown->data[common])
+		common++;
+	if (common > end)
+		common = end;
+	while (common && (target->data[common] & 0xC0) == 0x80)
+		common--;
+	if (common < target->length || common < shown->length)
+	{
+		editor_moveTo(editor, editor_width(shown->data, editor->shown_cursor),
+					  editor_width(target->data, common));
+		builder_append(&editor->output, target->data + common,
+					   target->length - common);
+		end = editor_width(target->data, target->length);
+		if (common < target->length && end % editor->columns == 0)
+			builder_append(&editor->output, "\r\n", 2);
+		if (editor_width(shown->data, shown->length) > end)
+			builder_append(&editor->output, "\033[J", 3);
+	}
+	else
+		end = editor_width(shown->data, editor->shown_cursor);
+	editor_moveTo(editor, end, editor_width(target->data, cursor));
+	swap = *shown;
+	*shown = *target;
+	*target = swap;
+	editor->shown_cursor = cursor;
+}
@@ -0,0 +1,142 @@
+#include "shell.h"
+
+/**
+* editor_prompt - function builds the prompt drawn before the line.
+*
+* Outside a Ctrl-R search it is the prompt the shell printed; during one
+* it shows the search text, and whether the last search failed.
+*
+* @editor: Pointer to the line editor.
+*/
+void editor_prompt(LineEditor *editor)
+{
+	editor->prompt.length = 0;
+	if (!editor->search_mode)
+	{
+		builder_append(&editor->prompt, editor->shell_prompt,
+					   str_length((char *)editor->shell_prompt));
+		return;
+	}
+	if (editor->search_mode == 2)
+		builder_append(&editor->prompt, "(failed ", 8);
+	else
+		builder_appendChar(&editor->prompt, '(');
+	builder_append(&editor->prompt, "reverse-i-search)`", 18);
+	builder_append(&editor->prompt, editor->query.data, editor->query.length);
+	builder_append(&editor->prompt, "': ", 3);
+}
+
+/**
+* editor_search - function looks up the search text in the history.
+*
+* The match is loaded into the line with the cursor on the matched text.
+* When nothing matches, the previous match is kept and the search is
+* marked as failed.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @older: 1 to look for a match older than the current one, 0 to allow
+* the current match as well.
+*/
+void editor_search(CommandInfo *information, LineEditor *editor, int older)
+{
+	HistoryIndex *index = information->history_index;
+	char *entry;
+	int id;
+	size_t i;
+
+	id = editor->search_match;
+	if (id != -1 && !older)
+		id++;
+	id = history_indexSearch(index, editor->query.length ?
+							 editor->query.data : "", id, 0);
+	editor->search_mode = id == -1 ? 2 : 1;
+	if (id == -1)
+		return;
+	editor->search_match = id;
+	entry = index->entries[id];
+	editor->line.length = 0;
+	builder_append(&editor->line, entry, str_length(entry));
+	for (i = 0; editor->query.length && entry[i]; i++)
+		if (checkIfPrefix(entry + i, editor->query.data))
+			break;
+	editor->cursor = entry[i] ? i : 0;
+}
+
+/**
+* editor_searchKey - function handles keys for the Ctrl-R search.
+*
+* Ctrl-R starts a search, or finds an older match during one. Typed
+* characters extend the search text, Backspace shortens it, Ctrl-G
+* cancels the search and Enter runs the match. Any other key ends the
+* search, keeping the match in the line, and is then applied normally.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+* @key: The decoded key.
+*
+* Return: -2 if the key must be applied normally, otherwise the result
+* of the key as for editor_processKey.
+*/
+int editor_searchKey(CommandInfo *information, LineEditor *editor, int key)
+{
+	if (!editor->search_mode && key != KEY_CONTROL('r'))
+		return (-2);
+	if (!editor->search_mode)
+	{
+		editor->saved.length = 0;
+		builder_append(&editor->saved, editor->line.data, editor->line.length);
+		editor->query.length = 0;
+		builder_append(&editor->query, "", 0);
+		editor->search_mode = 1;
+		editor->search_match = -1;
+		return (0);
+	}
+	if (key == KEY_CONTROL('r'))
+		editor_search(information, editor, 1);
+	else if (key == 127 || key == KEY_CONTROL('h'))
+	{
+		if (editor->query.length)
+			builder_erase(&editor->query, editor->query.length - 1, 1);
+		editor->search_match = -1;
+		editor_search(information, editor, 0);
+	}
+	else if (key >= ' ' && key < 256)
+	{
+		builder_appendChar(&editor->query, (char)key);
+		editor_search(information, editor, 0);
+	}
+	else if (key == KEY_CONTROL('g'))
+	{
+		editor->line.length = 0;
+		builder_append(&editor->line, editor->saved.data, editor->saved.length);
+		editor->cursor = editor->line.length;
+		editor->search_mode = 0;
+	}
+	else
+	{
+		editor->search_mode = 0;
+		return (key == '\r' || key == '\n' ? 1 : -2);
+	}
+	return (0);
+}
+
+/**
+* editor_suggest - function picks the suggestion shown after the line.
+*
+* A suggestion is only offered while the cursor is at the end of a non
+* empty line; it is the rest of the newest history entry starting with
+* the line.
+*
+* @information: Pointer to the command information structure.
+* @editor: Pointer to the line editor.
+*/
+void editor_suggest(CommandInfo *information, LineEditor *editor)
+{
+	editor->suggestion = NULL;
+	if (editor->search_mode || !editor->line.length ||
+		editor->cursor != editor->line.length)
+		return;
+	editor->suggestion = history_indexSuggest(information->history_index,
+											  editor->line.data);
+}
@@ -1,24 +1,4 @@
 #include "shell.h"
-/**
- * handleSigInt - function - signal handler for SIGINT (Ctrl+C).
- *
- * This function is a signal handler for the SIGINT signal (Ctrl+C). It prints
- * a newline, the shell prompt, and flushes the output buffer.
- *
- * @sigNum: The signal number (not used in the function).
- */
-void handleSigInt(__attribute__((unused)) int sigNum)
-{
-	/* Step 1: Print a newline */
-	print_str("\n");
-
-	/* Step 2: Print the shell prompt */
-	print_str("$ ");
-
-	/* Step 3: Flush the output buffer */
-	print_char(BUFFER_F);
-}
-
 /**
  * main - function executes the main logic of the custom shell program.
  *
@@ -65,8 +45,11 @@ int main(int argc, char **argv)
 			return (EXIT_FAILURE);
 		}
 		information->file_descriptor = file_descriptor;
+		descriptor_keep(&information->file_descriptor);
 	}
 	populateEnvironmentList(information);
+	zygote_start(information);
+	trace_open(information);
 	history_reading(information);
 	customShell(information, argv);
 	return (EXIT_SUCCESS);
@@ -105,6 +105,8 @@ void *realloc_Memory(void *oldPtr, unsigned int oldSize, unsigned int newSize)
 {
 	char *newPtr;
 
+	shell_counters[COUNTER_ALLOCATIONS]++;
+
 	/* Step 1: Check if 'oldPtr' is NULL */
 	if (!oldPtr)
 		return (malloc(newSize));
@@ -0,0 +1,111 @@
+#include "shell.h"
+
+/**
+* mem_swap - function exchanges two blocks of memory of the same size.
+*
+* @first: The first block.
+* @second: The second block.
+* @size: Size of each block in bytes.
+*/
+static void mem_swap(char *first, char *second, size_t size)
+{
+	char byte;
+
+	while (size--)
+	{
+		byte = first[size];
+		first[size] = second[size];
+		second[size] = byte;
+	}
+}
+
+/**
+* mem_sift - function moves an element down a heap until both its children
+* order before it.
+*
+* @base: The elements.
+* @root: Index of the element to move.
+* @count: Number of elements in the heap.
+* @size: Size of each element in bytes.
+* @compare: Orders two elements.
+*/
+static void mem_sift(char *base, size_t root, size_t count, size_t size,
+					 int (*compare)(const void *, const void *))
+{
+	size_t child;
+
+	while ((child = root * 2 + 1) < count)
+	{
+		if (child + 1 < count &&
+			compare(base + child * size, base + (child + 1) * size) < 0)
+			child++;
+		if (compare(base + root * size, base + child * size) >= 0)
+			return;
+		mem_swap(base + root * size, base + child * size, size);
+		root = child;
+	}
+}
+
+/**
+* mem_compare - function compares two blocks of memory byte by byte.
+*
+* @first: The first block.
+* @second: The second block.
+* @size: Number of bytes to compare.
+*
+* Return: Negative, zero or positive as the first differing byte, taken
+* unsigned, is lower, equal or greater in @first.
+*/
+int mem_compare(const void *first, const void *second, size_t size)
+{
+	const unsigned char *a = first, *b = second;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+		if (a[i] != b[i])
+			return (a[i] - b[i]);
+	return (0);
+}
+
+/**
+* mem_copy - function copies a block of memory to one it does not overlap.
+*
+* @destination: The block written.
+* @source: The block read.
+* @size: Number of bytes to copy.
+*
+* Return: @destination.
+*/
+void *mem_copy(void *destination, const void *source, size_t size)
+{
+	unsigned char *to = destination;
+	const unsigned char *from = source;
+
+	while (size--)
+		*to++ = *from++;
+	return (destination);
+}
+
+/**
+* mem_sort - function sorts an array in place, as a heap sort, so it needs
+* no memory and takes n log n comparisons whatever the order given.
+*
+* @base: The elements.
+* @count: Number of elements.
+* @size: Size of each element in bytes.
+* @compare: Orders two elements, negative, zero or positive.
+*/
+void mem_sort(void *base, size_t count, size_t size,
+			  int (*compare)(const void *, const void *))
+{
+	char *bytes = base;
+	size_t i;
+
+	for (i = count / 2; i-- > 0;)
+		mem_sift(bytes, i, count, size, compare);
+	for (i = count; i-- > 1;)
+	{
+		mem_swap(bytes, bytes + i * size, size);
+		mem_sift(bytes, 0, i, size, compare);
+	}
+}
@@ -27,6 +27,7 @@ StringList *addNodeToList(StringList **head, const char *str, int n)
 	newNode = malloc(sizeof(StringList));
 	if (!newNode)
 		return (NULL);
+	shell_counters[COUNTER_ALLOCATIONS]++;
 
 	/* Step 3: Initialize the new node and set its numerical value */
 	fillMemoryBlock((void *)newNode, 0, sizeof(StringList));
@@ -77,19 +78,17 @@ StringList *addNodeToEndOfList(StringList **head, const char *str, int n)
 	if (!head)
 		return (NULL);
 
-	/* Step 2: Get a reference to the head of the linked list */
-	node = *head;
-
-	/* Step 3: Allocate memory for the new node */
+	/* Step 2: Allocate memory for the new node */
 	newNode = malloc(sizeof(StringList));
 	if (!newNode)
 		return (NULL);
+	shell_counters[COUNTER_ALLOCATIONS]++;
 
-	/* Step 4: Initialize the new node and set its numerical value */
+	/* Step 3: Initialize the new node and set its numerical value */
 	fillMemoryBlock((void *)newNode, 0, sizeof(StringList));
 	newNode->number = n;
 
-	/* Step 5: Copy the string value (if provided) */
+	/* Step 4: Copy the string value (if provided) */
 	if (str)
 	{
 		newNode->string = str_duplicate(str);
@@ -100,7 +99,8 @@ StringList *addNodeToEndOfList(StringList **head, const char *str, int n)
 		}
 	}
 
-	/* Step 6: Append the new node to the end of the linked list */
+	/* Step 5: Append the new node to the end of the linked list */
+	node = *head;
 	if (node)
 	{
 		while (node->next)
@@ -109,7 +109,7 @@ StringList *addNodeToEndOfList(StringList **head, const char *str, int n)
 	}
 	else
 		*head = newNode;
-	/* Step 7: Return a pointer to the new node */
+	/* Step 6: Return a pointer to the new node */
 	return (newNode);
 }
 
@@ -133,9 +133,11 @@ StringList *findNodeWithPrefix(StringList *head, char *prefix, char c)
 {
 	char *substringStart = NULL;
 
+	shell_counters[COUNTER_LIST_WALKS]++;
 	/* Step 1: Iterate through the linked list */
 	while (head)
 	{
+		shell_counters[COUNTER_LIST_STEPS]++;
 		/* Check if the string in the node starts with the specified prefix */
 		substringStart = checkIfPrefix(head->string, prefix);
 
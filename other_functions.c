@@ -89,3 +89,43 @@ char *find_command_path(CommandInfo *information,
 	}
 	return (NULL);
 }
+
+/**
+ * handleSigInt - function - signal handler for SIGINT (Ctrl+C).
+ *
+ * This function is a signal handler for the SIGINT signal (Ctrl+C). It prints
+ * a newline, the shell prompt, and flushes the output buffer.
+ *
+ * @sigNum: The signal number (not used in the function).
+ */
+void handleSigInt(__attribute__((unused)) int sigNum)
+{
+	/* Step 1: Print a newline */
+	print_str("\n");
+
+	/* Step 2: Print the shell prompt */
+	print_str(SHELL_PROMPT);
+
+	/* Step 3: Flush the output buffer */
+	print_char(BUFFER_F);
+}
+
+/**
+* child_exit - function ends a child of the shell that ran commands itself,
+* a command substitution or a subshell, with the status of the last one.
+*
+* What the child printed, to stdout or to stderr, is still buffered and is
+* written first; what the shell saves when it exits is left to the shell.
+* It never returns.
+*
+* @information: Pointer to the command information structure.
+* @result: What running the commands returned, -2 if exit ran.
+*/
+void child_exit(CommandInfo *information, int result)
+{
+	if (result == -2 && information->error_number != -1)
+		information->execution_status = information->error_number;
+	error_print_char(BUFFER_F);
+	print_char(BUFFER_F);
+	_exit(information->execution_status);
+}
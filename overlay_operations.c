@@ -0,0 +1,112 @@
+#include "shell.h"
+
+/**
+* overlay_split - function takes the "NAME=value" words off the front of a
+* command, to be added to the environment of that command only.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 0 on success, -1 if a variable is readonly or memory allocation
+* fails, and the command is not to run.
+*/
+int overlay_split(CommandInfo *information)
+{
+	char **words = information->arguments_array, **overlay;
+	int count = information->assignments, i;
+	ShellVariable *variable;
+	size_t length;
+
+	overlay = malloc(sizeof(char *) * (count + 1));
+	if (!overlay)
+		return (information->execution_status = 1, -1);
+	for (i = 0; i < count; i++)
+	{
+		length = variable_nameLength(words[i], str_length(words[i]));
+		variable = variable_find(information, words[i], length);
+		if (variable && variable->flags & VARIABLE_READONLY)
+		{
+			variable_readonly(information, words[i], length);
+			return (free(overlay), -1);
+		}
+		overlay[i] = words[i];
+	}
+	overlay[count] = NULL;
+	for (i = count; words[i]; i++)
+		words[i - count] = words[i];
+	words[i - count] = NULL;
+	information->argument_count -= count;
+	information->assignments = 0;
+	information->overlay = overlay;
+	return (0);
+}
+
+/**
+* overlay_environment - function gives the environment of the command
+* about to run.
+*
+* With no "NAME=value" prefix this is the cached envp. Otherwise a new
+* array shares the pointers of the cached entries, the overridden ones
+* replaced by pointers to the prefix words, so no string is copied and the
+* shell's own environment is left as it is.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: The environment, NULL terminated.
+*/
+char **overlay_environment(CommandInfo *information)
+{
+	char **base = getEnvironmentVariables(information), **envp, **word;
+	size_t count = 0, extra = 0, i, j, length;
+
+	if (!information->overlay)
+		return (base);
+	for (; base && base[count]; count++)
+		;
+	for (word = information->overlay; *word; word++)
+		extra++;
+	envp = malloc(sizeof(char *) * (count + extra + 1));
+	if (!envp)
+		return (base);
+	for (i = 0; i < count; i++)
+		envp[i] = base[i];
+	for (word = information->overlay; *word; word++)
+	{
+		length = variable_nameLength(*word, str_length(*word)) + 1;
+		for (i = 0; i < count; i++)
+		{
+			for (j = 0; j < length && envp[i][j] == (*word)[j]; j++)
+				;
+			if (j == length)
+				break;
+		}
+		if (i == count)
+			count++;
+		envp[i] = *word;
+	}
+	envp[count] = NULL;
+	return (envp);
+}
+
+/**
+* overlay_get - function retrieves an environment variable as the command
+* about to run will see it.
+*
+* @information: Pointer to the command information structure.
+* @name: The name followed by '=', as for getEnvironmentVariable.
+*
+* Return: The value, or NULL if it is not set or empty.
+*/
+char *overlay_get(CommandInfo *information, const char *name)
+{
+	char **word, *value, *found = NULL;
+
+	for (word = information->overlay; word && *word; word++)
+	{
+		value = checkIfPrefix(*word, name);
+		if (value)
+			found = value;
+	}
+	if (!found)
+		return (getEnvironmentVariable(information, name));
+	return (*found ? found : NULL);
+}
@@ -19,6 +19,10 @@ int print_char(char character)
 
 	static char buffer[BUFFER_WR];
 
+	/* A substitution running in the shell process collects the output */
+	if (output_capture && character != BUFFER_F)
+		return (builder_appendChar(output_capture, character), 1);
+
 	/*Check if the character is the flushing character or the buffer is full */
 	if (character == BUFFER_F || bufferIndex >= BUFFER_WR)
 	{
@@ -0,0 +1,116 @@
+#include "shell.h"
+
+/**
+* script_isBinary - function tells whether a file that is no executable
+* format holds text a shell could read.
+*
+* As other shells do, a NUL byte in the first line marks a binary file.
+*
+* @descriptor: The file, read from its start.
+*
+* Return: 1 if the file is binary, 0 otherwise.
+*/
+static int script_isBinary(int descriptor)
+{
+	char head[80];
+	ssize_t count = read(descriptor, head, sizeof(head)), i;
+
+	for (i = 0; i < count && head[i] != '\n'; i++)
+		if (!head[i])
+			return (1);
+	return (0);
+}
+
+/**
+* script_fresh - function leaves a child only what a new shell started
+* with its environment would have.
+*
+* The NAME=value words of the command join the environment, while the
+* variables, the arrays, the aliases and the caches built from them are
+* dropped.
+*
+* @information: Pointer to the command information structure.
+*/
+static void script_fresh(CommandInfo *information)
+{
+	char **envp = overlay_environment(information), **word;
+	StringList *environment = NULL;
+
+	for (word = envp; word && *word; word++)
+		addNodeToEndOfList(&environment, *word, 0);
+	if (envp != getEnvironmentVariables(information))
+		free(envp);
+	freeLinkedList(&information->environment_list);
+	information->environment_list = environment;
+	information->environment_modified = 1;
+	freeLinkedList(&information->command_alias);
+	variable_free(information);
+	arith_free(information);
+	case_free(information);
+	regex_free(information);
+}
+
+/**
+* script_run - function runs a file execve refused with ENOEXEC, a script
+* with no "#!" line, in the forked child that tried it.
+*
+* Rather than exec another shell, the child drops the input of its parent
+* and everything but the environment, and reads the file as "hsh file"
+* would; like a subshell, it leaves to the shell what the shell saves
+* when it exits. It never returns.
+*
+* @information: Pointer to the command information structure.
+*/
+void script_run(CommandInfo *information)
+{
+	char *arguments[3], *message = NULL;
+	int descriptor = open(information->executable_path, O_RDONLY);
+
+	if (descriptor == -1)
+		message = errno == EACCES ? "Permission denied\n" : "not found\n";
+	else if (script_isBinary(descriptor) ||
+			 lseek(descriptor, 0, SEEK_SET) == -1)
+		message = "cannot execute binary file\n";
+	if (message)
+	{
+		printErrorMessage(information, message);
+		error_print_char(BUFFER_F);
+		information_free(information, 1);
+		exit(*message == 'n' ? 127 : 126);
+	}
+	arguments[0] = information->file_name;
+	arguments[1] = str_duplicate(information->executable_path);
+	arguments[2] = NULL;
+	script_fresh(information);
+	information_free(information, 0);
+	if (information->file_descriptor > 2)
+		close(information->file_descriptor);
+	information->file_descriptor = descriptor;
+	descriptor_keep(&information->file_descriptor);
+	information->command_buffer_type = COMMAND_NORMAL;
+	information->current_line = 0;
+	information->timing = NULL;
+	information->subshell = 1;
+	input_reset();
+	descriptor = shell_loop(information, arguments);
+	free(arguments[1]);
+	child_exit(information, descriptor);
+}
+
+/**
+* script_atEnd - function tells whether a script was read to its end.
+*
+* Only a regular file tells so without being read; a pipe or a terminal
+* is never taken as ended before a read returns nothing.
+*
+* @descriptor: The script.
+*
+* Return: 1 if the offset is at the end of a regular file, 0 otherwise.
+*/
+int script_atEnd(int descriptor)
+{
+	struct stat status;
+
+	return (fstat(descriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+			lseek(descriptor, 0, SEEK_CUR) >= status.st_size);
+}
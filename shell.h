@@ -1,6 +1,8 @@
 #ifndef _SHELL_H_
 #define _SHELL_H_
 
+#define _GNU_SOURCE
+
 /* LIBRARIES */
 #include <fcntl.h>
 #include <stdio.h>
@@ -15,6 +17,19 @@
 #include <stddef.h>
 # include <bits/stat.h>
 #include <linux/stat.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <regex.h>
+#include <sys/socket.h>
 
 /*------------------------------------------------*/
 /* Defines constants for specific conversion operations. */
@@ -42,13 +57,196 @@
 #define BUFFER_RD 1024
 #define BUFFER_WR 1024
 #define BUFFER_F -1
+
+/* Room made for every read of a command substitution's output */
+#define SUBSTITUTION_READ 4096
+/*------------------------------------------------*/
+
+#define SHELL_PROMPT "$ "
+#define CONTINUATION_PROMPT "> "
+
+/* Keys decoded from terminal escape sequences by the line editor */
+
+#define KEY_UP 0x101
+#define KEY_DOWN 0x102
+#define KEY_RIGHT 0x103
+#define KEY_LEFT 0x104
+#define KEY_HOME 0x105
+#define KEY_END 0x106
+#define KEY_DELETE 0x107
+#define KEY_WORD_LEFT 0x108
+#define KEY_WORD_RIGHT 0x109
+#define KEY_CONTROL(k) ((k) & 0x1f)
+
 /*------------------------------------------------*/
 
 #define HISTORY_FILE ".simple_shell_history"
 #define HISTORY_MAX 4096
 
+/* Shared history log (enabled by the HSH_SHARED_HISTORY variable) */
+
+#define HISTORY_LOG_FILE ".simple_shell_history.log"
+#define HISTORY_LOG_SIZE (1UL << 22)	/**< Capacity of the mapped log */
+#define HISTORY_LOG_MAGIC 0x48534832	/**< "HSH2" */
+#define HISTORY_LOG_WAIT 100	/**< Milliseconds rotation waits for a record */
+#define HISTORY_RECORD_COMMITTED 1	/**< Record payload is complete */
+#define HISTORY_CLAIM(size, pid) \
+	((unsigned long)(unsigned int)(pid) << 32 | (unsigned int)(size))
+#define HISTORY_CLAIM_SIZE(claim) ((unsigned int)(claim))
+#define HISTORY_CLAIM_PID(claim) ((int)((claim) >> 32))
+
+/* History search index */
+
+#define HISTORY_TRIE_DEPTH 24	/**< Prefix length covered by the trie */
+
+/* Tab completion */
+
+#define COMPLETION_FILES_TTL 2	/**< Seconds a directory listing is reused */
+#define COMPLETION_LIST_MAX 200	/**< Most candidates listed on screen */
+
+/* Tracer (enabled by the HSH_TRACE variable, naming the output file) */
+
+#define TRACE_CAPACITY (1 << 17)	/**< Spans kept, later ones are dropped */
+#define TRACE_READ 0		/**< Reading a line of input */
+#define TRACE_PARSE 1		/**< Splitting the line at ; && || */
+#define TRACE_TOKENIZE 2	/**< Splitting a command into words */
+#define TRACE_ALIAS 3		/**< Alias replacement */
+#define TRACE_EXPAND 4		/**< Variable replacement */
+#define TRACE_LOOKUP 5		/**< Searching PATH */
+#define TRACE_FORK 6		/**< fork() in the shell */
+#define TRACE_WAIT 7		/**< Waiting for the child */
+#define TRACE_BUILTIN 8		/**< Running a builtin */
+#define TRACE_COMMAND 9		/**< A whole command, all phases included */
+
+/* Counters (see shstat; exported at exit to the HSH_STATS_FILE file) */
+
+#define COUNTER_COMMANDS 0	/**< Commands run */
+#define COUNTER_BUILTINS 1	/**< Builtins run */
+#define COUNTER_FORKS 2		/**< fork() calls */
+#define COUNTER_STATS 3		/**< stat() calls from isCommand */
+#define COUNTER_ALLOCATIONS 4	/**< Allocations by the string/list helpers */
+#define COUNTER_BYTES_READ 5	/**< Bytes of input read */
+#define COUNTER_LIST_WALKS 6	/**< findNodeWithPrefix calls */
+#define COUNTER_LIST_STEPS 7	/**< Nodes visited by findNodeWithPrefix */
+#define COUNTER_COMPLETION_HITS 8	/**< Directory listings reused */
+#define COUNTER_COMPLETION_MISSES 9	/**< Directories read for completion */
+#define COUNTER_ARITH_HITS 10	/**< Arithmetic expressions found parsed */
+#define COUNTER_ARITH_MISSES 11	/**< Arithmetic expressions parsed */
+#define COUNTER_SUBSTITUTIONS 12	/**< Command substitutions run */
+#define COUNTER_CAPTURED 13	/**< Command substitutions run without fork */
+#define COUNTER_EXECS 14	/**< Commands run in place of the shell */
+#define COUNTER_ZYGOTE 15	/**< Commands started by the zygote */
+#define COUNTER_EXEC_HITS 16	/**< Programs launched from their descriptor */
+#define COUNTER_EXEC_MISSES 17	/**< Programs opened for the executable cache */
+#define COUNTER_MAX 18
+
+/* Shell variables */
+
+#define VARIABLE_READONLY 1	/**< Cannot be assigned or unset */
+#define VARIABLE_EXPORTED 2	/**< Value kept in the environment list */
+#define VARIABLE_ARRAY 4	/**< Indexed array */
+#define VARIABLE_ASSOCIATIVE 8	/**< Associative array */
+#define VARIABLE_BUCKETS 16	/**< Initial number of hash table buckets */
+
+/* Arithmetic evaluation: $(( )) and (( )) */
+
+#define ARITH_CACHE_SIZE 32	/**< Parsed expressions kept */
+#define ARITH_DEPTH_MAX 16	/**< Nesting of variables holding expressions */
+#define ARITH_PUSH 0		/**< Push a number */
+#define ARITH_LOAD 1		/**< Push the value of a variable */
+#define ARITH_STORE 2		/**< Assign the top of the stack to a variable */
+#define ARITH_POP 3		/**< Drop the top of the stack */
+#define ARITH_JUMP 4		/**< Jump */
+#define ARITH_JUMP_FALSE 5	/**< Pop, jump if zero */
+#define ARITH_AND 6		/**< Jump keeping a zero top, else pop */
+#define ARITH_OR 7		/**< Jump with 1 on a non-zero top, else pop */
+#define ARITH_BOOL 8		/**< Turn the top into 0 or 1 */
+#define ARITH_NEGATE 9		/**< Unary - */
+#define ARITH_NOT 10		/**< ! */
+#define ARITH_COMPLEMENT 11	/**< ~ */
+#define ARITH_MULTIPLY 12	/**< Binary operators from here on */
+#define ARITH_DIVIDE 13
+#define ARITH_MODULO 14
+#define ARITH_ADD 15
+#define ARITH_SUBTRACT 16
+#define ARITH_SHIFT_LEFT 17
+#define ARITH_SHIFT_RIGHT 18
+#define ARITH_LESS 19
+#define ARITH_LESS_EQUAL 20
+#define ARITH_GREATER 21
+#define ARITH_GREATER_EQUAL 22
+#define ARITH_EQUAL 23
+#define ARITH_NOT_EQUAL 24
+#define ARITH_BIT_AND 25
+#define ARITH_BIT_XOR 26
+#define ARITH_BIT_OR 27
+#define ARITH_POWER 28
+
+/* case statements */
+
+#define CASE_CACHE_SIZE 8	/**< Compiled statements kept */
+#define CASE_STATES_MAX 256	/**< DFA states built before starting over */
+#define CASE_BREAK 0		/**< ";;" ends the statement */
+#define CASE_FALLTHROUGH 1	/**< ";&" runs the next list as well */
+#define CASE_CONTINUE 2		/**< ";;&" tests the next patterns */
+#define CASE_BITS (8 * sizeof(unsigned long))
+
+/* conditional expressions */
+
+#define REGEX_CACHE_SIZE 16	/**< Compiled "=~" patterns kept */
+
+/* descriptors */
+
+#define DESCRIPTOR_SHELL 10	/**< Lowest descriptor the shell keeps */
+#define DESCRIPTOR_SLOTS 32	/**< Descriptors of its own the shell tracks */
+
+/* zygote (started when the HSH_ZYGOTE variable is set) */
+
+#define ZYGOTE_FDS DESCRIPTOR_SHELL	/**< Descriptors passed to commands */
+
+/* executable cache (enabled by the HSH_EXEC_CACHE variable) */
+
+#define EXEC_CACHE_SIZE 16	/**< Programs kept open */
+
+/* Changes in a directory that may add, remove or replace a program */
+#define DIRECTORY_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | \
+IN_MOVED_TO | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF)
+
+/**
+ * struct ZygoteHeader - Start of a request to the zygote, followed by the
+ * working directory, the path, the arguments and the environment, each
+ * NUL terminated.
+ *
+ * @passed: 1 for each descriptor below ZYGOTE_FDS sent along, in order
+ * @arguments: Number of arguments
+ * @variables: Number of environment entries
+ */
+typedef struct ZygoteHeader
+{
+	unsigned char passed[ZYGOTE_FDS];
+	int arguments;
+	int variables;
+} ZygoteHeader;
+
+/**
+ * struct ZygoteReply - Answer of the zygote once the command is over.
+ *
+ * @pid: Process of the command, -1 if fork failed
+ * @error: errno of the failed execve, 0 if the command ran
+ * @status: Wait status of the command
+ * @usage: Resources the command used
+ */
+typedef struct ZygoteReply
+{
+	pid_t pid;
+	int error;
+	int status;
+	struct rusage usage;
+} ZygoteReply;
+
 /*------------------------------------------------*/
 extern char **environ;
+extern unsigned long shell_counters[COUNTER_MAX];
 /*------------------------------------------------*/
 
 /**
@@ -69,6 +267,690 @@ typedef struct StringList
 	struct StringList *next; /**< Pointer to the next node in the linked list */
 } StringList;
 
+/**
+ * struct TraceSpan - One phase of a command, recorded by the tracer.
+ *
+ * @start: Start time in nanoseconds (CLOCK_MONOTONIC)
+ * @duration: Duration in nanoseconds
+ * @phase: One of the TRACE_ constants
+ * @line: Input line the command came from
+ */
+typedef struct TraceSpan
+{
+	unsigned long start;
+	unsigned long duration;
+	int phase;
+	unsigned int line;
+} TraceSpan;
+
+/*------------------------------------------------*/
+
+/**
+ * struct HistoryLogHeader - Header at the start of the shared history log.
+ *
+ * The header lives inside the shared mapping. @tail is only ever advanced
+ * with an atomic compare-and-swap, past a record already claimed, so
+ * sessions append without locking.
+ *
+ * @magic: HISTORY_LOG_MAGIC once the log is initialised
+ * @rotated: Set to 1 once the log has been replaced by a newer file
+ * @capacity: Size in bytes of the whole mapping
+ * @tail: Offset of the first free byte (atomic)
+ * @base: Offset of the first record appended after the last rotation
+ */
+typedef struct HistoryLogHeader
+{
+	unsigned int magic;
+	unsigned int rotated;
+	unsigned long capacity;
+	unsigned long tail;
+	unsigned long base;
+} HistoryLogHeader;
+
+/**
+ * struct HistoryRecord - Fixed-size header preceding every log entry.
+ *
+ * The command text follows the header, NUL terminated and padded so the
+ * next record starts on an 8 byte boundary.
+ *
+ * @claim: Total record size including padding and process id of the
+ * session that appended the record, packed by HISTORY_CLAIM and stored
+ * with one compare-and-swap; 0 while the space is free, and a pid of 0
+ * for the space left unused when the log was rotated
+ * @state: HISTORY_RECORD_COMMITTED once the text has been written
+ * @length: Length of the command text
+ */
+typedef struct HistoryRecord
+{
+	unsigned long claim;
+	unsigned int state;
+	unsigned int length;
+} HistoryRecord;
+
+/**
+ * struct HistoryLog - Per-session view of the shared history log.
+ *
+ * @descriptor: File descriptor of the mapped log
+ * @map: Start of the shared mapping
+ * @header: Header at the start of the mapping
+ * @seen: Offset up to which this session has read records
+ * @path: Full path of the log file
+ */
+typedef struct HistoryLog
+{
+	int descriptor;
+	char *map;
+	HistoryLogHeader *header;
+	unsigned long seen;
+	char *path;
+} HistoryLog;
+
+/**
+ * struct HistoryPosting - Entries of the history containing one trigram.
+ *
+ * @key: The three bytes of the trigram, 0 for an unused slot
+ * @count: Number of entry ids in @ids
+ * @capacity: Number of entry ids allocated
+ * @ids: Ids of the entries containing the trigram, in increasing order
+ */
+typedef struct HistoryPosting
+{
+	unsigned int key;
+	unsigned int count;
+	unsigned int capacity;
+	unsigned int *ids;
+} HistoryPosting;
+
+/**
+ * struct HistoryTrieNode - Node of the history prefix trie.
+ *
+ * @child: Index of the first child, 0 if none
+ * @sibling: Index of the next sibling, 0 if none
+ * @latest: Id of the newest entry starting with this node's prefix
+ * @byte: Character leading to this node from its parent
+ */
+typedef struct HistoryTrieNode
+{
+	int child;
+	int sibling;
+	int latest;
+	unsigned char byte;
+} HistoryTrieNode;
+
+/**
+ * struct HistoryIndex - Search index over the command history.
+ *
+ * Entries are numbered in the order they were added, oldest first. A hash
+ * table of trigram posting lists answers substring searches, and a trie
+ * over the first HISTORY_TRIE_DEPTH characters answers prefix queries.
+ * The oldest entries are dropped as the history list is trimmed, and the
+ * ids lowered once as many were dropped as are kept.
+ *
+ * @entries: Copies of the indexed entries, NULL for a dropped one
+ * @count: Number of entries, dropped ones included
+ * @first: Id of the oldest entry kept
+ * @capacity: Number of entry slots allocated
+ * @postings: Open addressing table of posting lists
+ * @posting_count: Number of slots in use in @postings
+ * @posting_capacity: Number of slots in @postings, a power of two
+ * @nodes: Trie nodes, node 0 being the root
+ * @node_count: Number of trie nodes in use
+ * @node_capacity: Number of trie nodes allocated
+ */
+typedef struct HistoryIndex
+{
+	char **entries;
+	size_t count;
+	size_t first;
+	size_t capacity;
+	HistoryPosting *postings;
+	size_t posting_count;
+	size_t posting_capacity;
+	HistoryTrieNode *nodes;
+	size_t node_count;
+	size_t node_capacity;
+} HistoryIndex;
+
+/**
+ * struct StringBuilder - Growable, NUL terminated character buffer.
+ *
+ * @data: The characters, NULL until something is appended
+ * @length: Number of characters in use
+ * @capacity: Number of bytes allocated for @data
+ */
+typedef struct StringBuilder
+{
+	char *data;
+	size_t length;
+	size_t capacity;
+} StringBuilder;
+
+/* Buffer receiving what print_char outputs, while a substitution runs */
+extern StringBuilder *output_capture;
+
+/**
+ * struct LineEditor - State of the interactive line editor.
+ *
+ * The editor keeps a copy of what it last drew on the terminal (@shown)
+ * so every keystroke only redraws the part of the line that changed.
+ *
+ * @line: The line being edited
+ * @cursor: Cursor position in @line
+ * @shown: Text currently on screen: prompt followed by the line
+ * @shown_cursor: Cursor position in @shown
+ * @target: Text to draw next, built by the renderer
+ * @output: Escape sequences and text batched into a single write
+ * @yank: Text removed by the last kill command
+ * @saved: Line being edited before history recall started
+ * @pending: Input bytes read past the end of the previous line
+ * @pending_index: Next unprocessed byte in @pending
+ * @history_index: Index of the recalled history entry
+ * @columns: Width of the terminal
+ * @escape_state: Progress through an escape sequence
+ * @escape_number: Numeric parameter of the escape sequence
+ * @original: Terminal settings to restore after editing
+ * @prompt: Prompt drawn before the line
+ * @shell_prompt: The prompt the shell printed before the line, "$ " or
+ * the "> " of a continuation line
+ * @suggestion: Suggested completion of the line, drawn dimmed
+ * @query: Text searched for by Ctrl-R
+ * @search_mode: 1 while a Ctrl-R search is in progress
+ * @search_match: Index entry id of the current search match, -1 if none
+ */
+typedef struct LineEditor
+{
+	StringBuilder line;
+	size_t cursor;
+	StringBuilder shown;
+	size_t shown_cursor;
+	StringBuilder target;
+	StringBuilder output;
+	StringBuilder yank;
+	StringBuilder saved;
+	StringBuilder pending;
+	size_t pending_index;
+	int history_index;
+	size_t columns;
+	int escape_state;
+	int escape_number;
+	struct termios original;
+	StringBuilder prompt;
+	const char *shell_prompt;
+	const char *suggestion;
+	StringBuilder query;
+	int search_mode;
+	int search_match;
+} LineEditor;
+
+/**
+ * struct CompletionList - Sorted list of completion candidates.
+ *
+ * @names: The candidates, sorted and without duplicates
+ * @count: Number of candidates
+ * @capacity: Number of slots allocated in @names
+ */
+typedef struct CompletionList
+{
+	char **names;
+	size_t count;
+	size_t capacity;
+} CompletionList;
+
+/**
+ * struct CompletionIndex - Candidates for Tab completion.
+ *
+ * The command names are read once from the PATH directories, which are
+ * then watched with inotify so the list is only rebuilt after one of them
+ * changes. Directory listings for filename completion are kept for a
+ * couple of seconds, so repeated Tabs do not read the directory again.
+ *
+ * @commands: Executables found in the PATH directories
+ * @notify: inotify descriptor watching the PATH directories, -1 if none
+ * @stale: 1 when @commands must be rebuilt before use
+ * @files: Entries of @directory, directories ending with '/'
+ * @directory: Directory listed in @files, NULL if none
+ * @listed: Time @files was read, in seconds
+ */
+typedef struct CompletionIndex
+{
+	CompletionList commands;
+	int notify;
+	int stale;
+	CompletionList files;
+	char *directory;
+	time_t listed;
+} CompletionIndex;
+
+/**
+ * struct CommandTiming - Measurement started by the time keyword.
+ *
+ * @start: Wall clock (CLOCK_MONOTONIC) when the timed commands started
+ * @self: Resource usage of the shell when they started, for builtins
+ * @children: Resource usage of the commands run since, from wait4()
+ * @posix: 1 for the POSIX output format of "time -p"
+ */
+typedef struct CommandTiming
+{
+	struct timespec start;
+	struct rusage self;
+	struct rusage children;
+	int posix;
+} CommandTiming;
+
+/**
+ * struct GlobToken - One position of a compiled glob pattern.
+ *
+ * Literal characters, '?' and bracket expressions all compile to the set
+ * of bytes they accept, so matching a character is a single bit test.
+ *
+ * @star: 1 for '*', which matches any run of characters
+ * @set: Bitmap of the 256 byte values accepted, unused for '*'
+ */
+typedef struct GlobToken
+{
+	int star;
+	unsigned char set[32];
+} GlobToken;
+
+/**
+ * struct GlobPattern - Glob pattern compiled for repeated matching.
+ *
+ * @tokens: The positions of the pattern, consecutive '*' merged
+ * @count: Number of tokens
+ * @states: Scratch space for the matcher, two sets of @count + 1 states
+ */
+typedef struct GlobPattern
+{
+	GlobToken *tokens;
+	size_t count;
+	unsigned char *states;
+} GlobPattern;
+
+/**
+ * struct GlobKey - Path being sorted, with its first bytes as a number.
+ *
+ * @prefix: The first sizeof(unsigned long) bytes, the first one most
+ * significant, zero past the end of the path
+ * @name: The path
+ */
+typedef struct GlobKey
+{
+	unsigned long prefix;
+	char *name;
+} GlobKey;
+
+/**
+ * struct GlobDirectory - Listing of a directory read while globbing.
+ *
+ * A command line reads every directory once, however many of its words
+ * look into it.
+ *
+ * @path: The directory, as written in the pattern, "" for the current one
+ * @entries: Its entries but "." and "..", directories ending with '/'
+ * @next: Next directory listed
+ */
+typedef struct GlobDirectory
+{
+	char *path;
+	CompletionList entries;
+	struct GlobDirectory *next;
+} GlobDirectory;
+
+/**
+ * struct ArithOp - One instruction of a parsed arithmetic expression.
+ *
+ * @code: One of the ARITH_ constants
+ * @value: Number pushed, jump target, or offset of a variable name in the
+ * expression text
+ * @length: Length of the variable name
+ */
+typedef struct ArithOp
+{
+	int code;
+	long value;
+	size_t length;
+} ArithOp;
+
+/**
+ * struct ArithProgram - Arithmetic expression parsed to stack code.
+ *
+ * @text: Copy of the expression, which the variable names point into
+ * @length: Length of @text
+ * @ops: The instructions
+ * @count: Number of instructions
+ * @capacity: Number of instructions allocated
+ * @stack: Evaluation stack, one slot per instruction
+ * @used: Cache clock when the program was last used
+ * @active: Number of evaluations of the program in progress
+ */
+typedef struct ArithProgram
+{
+	char *text;
+	size_t length;
+	ArithOp *ops;
+	size_t count;
+	size_t capacity;
+	long *stack;
+	unsigned long used;
+	int active;
+} ArithProgram;
+
+/**
+ * struct ArithCache - Parsed arithmetic expressions, keyed by their text.
+ *
+ * The least recently used program is replaced when the cache is full,
+ * never one being evaluated.
+ *
+ * @programs: The cached programs, unused slots having a NULL text
+ * @clock: Incremented on every lookup
+ */
+typedef struct ArithCache
+{
+	ArithProgram programs[ARITH_CACHE_SIZE];
+	unsigned long clock;
+} ArithCache;
+
+/**
+ * struct CaseArm - One "pattern) list ;;" of a case statement.
+ *
+ * @body: Offset of the list in the text of the statement
+ * @length: Length of the list
+ * @end: CASE_BREAK, CASE_FALLTHROUGH or CASE_CONTINUE
+ */
+typedef struct CaseArm
+{
+	size_t body;
+	size_t length;
+	int end;
+} CaseArm;
+
+/**
+ * struct CaseProgram - case statement compiled into a DFA.
+ *
+ * The patterns of all the arms form one NFA whose states are the
+ * positions in every pattern. DFA states, sets of NFA states, are built
+ * the first time a word needs them and kept, so matching a word against
+ * all the patterns is one table lookup per byte.
+ *
+ * @text: The statement, also the cache key
+ * @length: Length of @text
+ * @used: Cache clock when the program was last used
+ * @active: Number of runs of the statement in progress
+ * @dynamic: 1 if a pattern holds an expansion, so the program is not
+ * reused
+ * @word: Offset of the word tested
+ * @word_length: Length of the word
+ * @arms: The arms, in order
+ * @arm_count: Number of arms
+ * @tokens: Token read at every NFA state
+ * @accept: Arm whose pattern ends at every NFA state, -1 for none
+ * @nfa: Number of NFA states
+ * @words: Number of unsigned longs in a set of NFA states
+ * @classes: Class of every byte, bytes of a class moving the NFA alike
+ * @representative: One byte of every class
+ * @class_count: Number of classes
+ * @start: NFA states before the first byte
+ * @scratch: Set being built
+ * @sets: NFA states of every DFA state
+ * @next: Transitions by DFA state then class, -1 when not built yet
+ * @slots: Open addressing table of the DFA states by set, -1 when empty
+ * @count: Number of DFA states
+ * @dead: DFA state of the empty set, -1 while not built
+ */
+typedef struct CaseProgram
+{
+	char *text;
+	size_t length;
+	unsigned long used;
+	int active;
+	int dynamic;
+	size_t word;
+	size_t word_length;
+	CaseArm *arms;
+	size_t arm_count;
+	GlobToken *tokens;
+	long *accept;
+	size_t nfa;
+	size_t words;
+	unsigned char classes[256];
+	unsigned char representative[256];
+	size_t class_count;
+	unsigned long *start;
+	unsigned long *scratch;
+	unsigned long *sets;
+	long *next;
+	long *slots;
+	size_t count;
+	long dead;
+} CaseProgram;
+
+/**
+ * struct CaseCache - Compiled case statements, keyed by their text.
+ *
+ * @programs: The cached programs, unused slots having a NULL text
+ * @clock: Incremented on every lookup
+ */
+typedef struct CaseCache
+{
+	CaseProgram programs[CASE_CACHE_SIZE];
+	unsigned long clock;
+} CaseCache;
+
+/**
+ * struct RegexEntry - A compiled "=~" pattern.
+ *
+ * @text: The pattern, NULL for an unused slot
+ * @compiled: The compiled extended regular expression
+ * @used: Value of the cache clock at the last lookup
+ */
+typedef struct RegexEntry
+{
+	char *text;
+	regex_t compiled;
+	unsigned long used;
+} RegexEntry;
+
+/**
+ * struct RegexCache - Compiled "=~" patterns, keyed by their text.
+ *
+ * @entries: The cached patterns
+ * @clock: Incremented on every lookup
+ */
+typedef struct RegexCache
+{
+	RegexEntry entries[REGEX_CACHE_SIZE];
+	unsigned long clock;
+} RegexCache;
+
+/**
+ * struct ExecEntry - A program kept open to be launched with execveat.
+ *
+ * @path: Path find_command_path gave, NULL for an unused slot
+ * @descriptor: O_PATH descriptor of the program
+ * @modified: Modification time of the program when it was opened
+ * @used: Value of the cache clock at the last lookup
+ */
+typedef struct ExecEntry
+{
+	char *path;
+	int descriptor;
+	struct timespec modified;
+	unsigned long used;
+} ExecEntry;
+
+/**
+ * struct ExecCache - Programs launched lately, keyed by their path.
+ *
+ * The directories holding them are watched with inotify, as the PATH
+ * directories are for completion, so a program replaced at its path is
+ * noticed with no lookup of the path.
+ *
+ * @entries: The cached programs
+ * @clock: Incremented on every lookup
+ * @current: Descriptor of the program about to run, -1 if none
+ * @notify: inotify descriptor watching the directories of the programs
+ */
+typedef struct ExecCache
+{
+	ExecEntry entries[EXEC_CACHE_SIZE];
+	unsigned long clock;
+	int current;
+	int notify;
+} ExecCache;
+
+/**
+ * struct ConditionParser - State of a "[[ ... ]]" expression being read.
+ *
+ * @words: The words of the expression
+ * @position: Index of the next word to read
+ * @error: Status of the first error, 0 if none
+ */
+typedef struct ConditionParser
+{
+	char **words;
+	size_t position;
+	int error;
+} ConditionParser;
+
+/**
+ * struct ArrayEntry - Element of an associative array.
+ *
+ * @key: The key
+ * @value: The value, NULL once the element is unset
+ * @hash: Hash of the key
+ * @next: Index of the next entry of the same bucket, -1 for none
+ */
+typedef struct ArrayEntry
+{
+	char *key;
+	char *value;
+	unsigned long hash;
+	long next;
+} ArrayEntry;
+
+/**
+ * struct ShellArray - Elements of an indexed or associative array.
+ *
+ * An indexed array is a vector of values by index. An associative array
+ * keeps its entries in insertion order, chained by bucket through their
+ * indexes so that growing the vector does not break the chains.
+ *
+ * @items: Indexed: values by index, NULL where unset
+ * @entries: Associative: entries in insertion order
+ * @buckets: Associative: first entry of every bucket, -1 for none
+ * @count: Indexed: highest index set plus one; associative: entries used
+ * @capacity: Number of slots allocated in @items or @entries
+ * @size: Number of buckets, a power of two
+ */
+typedef struct ShellArray
+{
+	char **items;
+	ArrayEntry *entries;
+	long *buckets;
+	size_t count;
+	size_t capacity;
+	size_t size;
+} ShellArray;
+
+/**
+ * struct ShellVariable - Shell variable, or the attributes of an exported
+ * one.
+ *
+ * @name: The name
+ * @length: Length of the name
+ * @hash: Hash of the name
+ * @value: The value, NULL when unset or kept in the environment list
+ * @capacity: Bytes allocated for @value, reused by later assignments
+ * @flags: VARIABLE_READONLY, VARIABLE_EXPORTED, and VARIABLE_ARRAY or
+ * VARIABLE_ASSOCIATIVE
+ * @array: The elements of an array, NULL for a scalar
+ * @next: Next variable of the same bucket
+ */
+typedef struct ShellVariable
+{
+	char *name;
+	size_t length;
+	unsigned long hash;
+	char *value;
+	size_t capacity;
+	int flags;
+	ShellArray *array;
+	struct ShellVariable *next;
+} ShellVariable;
+
+/**
+ * struct VariableTable - Hash table of the shell variables.
+ *
+ * Variables that are not exported live only here, so assigning them does
+ * not touch the environment list nor invalidate the cached envp.
+ *
+ * @buckets: Chains of variables, indexed by the hash modulo @size
+ * @size: Number of buckets, a power of two
+ * @count: Number of variables
+ */
+typedef struct VariableTable
+{
+	ShellVariable **buckets;
+	size_t size;
+	size_t count;
+} VariableTable;
+
+/**
+ * struct ArithParser - State of the arithmetic expression parser.
+ *
+ * @text: The expression
+ * @position: Index of the next character to read
+ * @length: Length of @text
+ * @program: Program the instructions are appended to
+ * @lvalue: Index of the ARITH_LOAD of the operand just parsed when it is
+ * a bare variable, so it can be assigned, -1 otherwise
+ * @error: Message of the first error, NULL if none
+ */
+typedef struct ArithParser
+{
+	const char *text;
+	size_t position;
+	size_t length;
+	ArithProgram *program;
+	long lvalue;
+	const char *error;
+} ArithParser;
+
+/**
+ * struct ArithOperator - Infix operator of arithmetic expressions.
+ *
+ * @text: The operator
+ * @code: ARITH_ constant applied; for assignments, the operation done
+ * before storing, ARITH_STORE for a plain '='
+ * @precedence: Binding strength, 2 for assignments, higher binds tighter
+ */
+typedef struct ArithOperator
+{
+	const char *text;
+	int code;
+	int precedence;
+} ArithOperator;
+
+/**
+ * struct OutputSpec - Flags, width and precision of a printf conversion.
+ *
+ * @left: 1 for '-', padding on the right
+ * @zero: 1 for '0', numbers padded with zeros
+ * @sign: '+' or ' ' printed before a positive number, 0 for none
+ * @alternate: 1 for '#'
+ * @width: Minimum width, 0 for none
+ * @precision: Precision, -1 for none
+ */
+typedef struct OutputSpec
+{
+	int left;
+	int zero;
+	int sign;
+	int alternate;
+	int width;
+	int precision;
+} OutputSpec;
+
 /*------------------------------------------------*/
 
 
@@ -98,6 +980,13 @@ typedef struct StringList
  * @history_count: Count of command history
  * @execution_status: Status of command execution
  * @command_buffer: Pointer to the command chain buffer for memory management
+ * @history_log: Shared history log, NULL when the file history is used
+ * @line_editor: Interactive line editor, created on first use
+ * @history_index: Search index over the history, interactive shells only
+ * @completion: Tab completion candidates, created on first use
+ * @timing: Measurement of the chain being timed, NULL if none
+ * @arithmetic: Parsed arithmetic expressions, created on first use
+ * @expansion_error: Set when an expansion failed; the command is not run
  */
 typedef struct CommandInfo
 {
@@ -120,10 +1009,28 @@ typedef struct CommandInfo
 	int command_buffer_type;	  /**< Type of command: ||, &&, ; */
 	int file_descriptor;		  /**< File descriptor associated with the command */
 	int history_count;			  /**< Count of command history */
+	HistoryLog *history_log;	  /**< Shared history log, if enabled */
+	LineEditor *line_editor;	  /**< Interactive line editor */
+	HistoryIndex *history_index;  /**< Search index over the history */
+	CompletionIndex *completion;  /**< Tab completion candidates */
+	CommandTiming *timing;		  /**< Measurement of the timed chain */
+	ArithCache *arithmetic;		  /**< Parsed arithmetic expressions */
+	int expansion_error;		  /**< An expansion of the command failed */
+	VariableTable *variables;	  /**< Shell variables */
+	int assignments;			  /**< Leading NAME=value words */
+	char **overlay;				  /**< NAME=value words for this command */
+	StringBuilder *fields;		  /**< Word that "${a[@]}" splits */
+	CaseCache *cases;			  /**< Compiled case statements */
+	RegexCache *regexes;		  /**< Compiled "=~" patterns */
+	int last_command;			  /**< The command ends the script */
+	int subshell;				  /**< A child that leaves saving to the shell */
+	int descriptor_high;		  /**< Highest descriptor exec changed */
+	ExecCache *executables;		  /**< Programs kept open for execveat */
 } CommandInfo;
 
 #define COMMAND_INFO {NULL, NULL, NULL, 0, 0, 0, 0, NULL, NULL, \
-NULL, NULL, NULL, 0, 0, NULL, 0, 0, 0}
+NULL, NULL, NULL, 0, 0, NULL, 0, 0, 0, NULL, NULL, NULL, NULL, NULL, \
+NULL, 0, NULL, 0, NULL, NULL, NULL, NULL, 0, 0, 0, NULL}
 /*------------------------------------------------*/
 
 /**
@@ -135,6 +1042,8 @@ NULL, NULL, NULL, 0, 0, NULL, 0, 0, 0}
  *
  * @command_type: representation of the built-in command type
  * @command_function: Function pointer to the built-in command implementation
+ * @captured: Whether the builtin only prints, so that a command substitution
+ * made of it may run in the shell process
  */
 typedef struct BuiltinTable
 {
@@ -143,6 +1052,9 @@ typedef struct BuiltinTable
 
 	/**< Function pointer to the built-in command implementation */
 	int (*command_function)(CommandInfo *);
+
+	/**< Whether it may run in the shell process when captured */
+	int captured;
 } BuiltinTable;
 /*------------------------------------------------*/
 /* ///////// FUNCTIONS /////// */
@@ -160,6 +1072,8 @@ int convert_str_int(char *str);
 char *conver_longInt_str(long int number, int base, int flags);
 char **convert_list_arrstr(StringList *head);
 int variables_replacer(CommandInfo *information);
+int variables_splice(CommandInfo *information, int index,
+					 StringBuilder *output);
 
 /* printers */
 int print_char(char character);
@@ -205,6 +1119,12 @@ void freeStringArray(char **stringArray);
 int freeAndSetNull(void **memoryPtr);
 void *realloc_Memory(void *oldPtr, unsigned int oldSize, unsigned int newSize);
 
+/* memory_blocks */
+int mem_compare(const void *first, const void *second, size_t size);
+void *mem_copy(void *destination, const void *source, size_t size);
+void mem_sort(void *base, size_t count, size_t size,
+			  int (*compare)(const void *, const void *));
+
 
 /* lists */
 size_t printLinkedListStrings(const StringList *head);
@@ -225,6 +1145,7 @@ char *getEnvironmentVariable(CommandInfo *information, const char *name);
 int printEnvironmentVariables(CommandInfo *information);
 
 char **getEnvironmentVariables(CommandInfo *information);
+void environment_free(CommandInfo *information);
 
 int setEnvironmentVariable(CommandInfo *information,
 						   char *variable, char *value);
@@ -252,17 +1173,44 @@ void handleCommandChain(CommandInfo *information, char *buffer,
 
 /* buffer operations */
 ssize_t checkInput(CommandInfo *information);
+ssize_t readUserInput(CommandInfo *information,
+					  char **buffer, size_t *buffer_size);
 
 ssize_t read_input_buffer(CommandInfo *information,
 													char *buffer, size_t *index);
 
 ssize_t custom_getline(CommandInfo *information,
 					   char **buffer, size_t *buffer_size);
+void input_reset(void);
 
 /* command operationa */
 void forkAndExecuteCommand(CommandInfo *information);
 void findAndExecuteCommand(CommandInfo *information);
 int customShell(CommandInfo *information, char **arguments);
+int shell_loop(CommandInfo *information, char **arguments);
+int dispatchCommand(CommandInfo *information);
+int command_runList(CommandInfo *information, char *text);
+
+/* tracer */
+void trace_open(CommandInfo *information);
+unsigned long trace_begin(void);
+void trace_end(int phase, unsigned long start, unsigned int line);
+void trace_write(void);
+
+/* counters */
+int shstat_command(CommandInfo *information);
+void counter_dump(CommandInfo *information);
+
+/* time keyword */
+void time_appendDuration(StringBuilder *output, long seconds,
+						 long microseconds, int posix);
+void time_start(CommandInfo *information);
+void time_report(CommandInfo *information);
+void time_free(CommandInfo *information);
+void time_addUsage(CommandInfo *information, struct rusage *usage);
+void time_appendUsage(StringBuilder *output, struct rusage *self,
+					  CommandTiming *timing);
+int times_command(CommandInfo *information);
 
 
 /* information */
@@ -277,8 +1225,30 @@ int print_command_history(CommandInfo *information);
 
 int history_buildList(CommandInfo *information, char *buffer, int line_count);
 int history_reNumber(CommandInfo *information);
+void history_free(CommandInfo *information);
 int history_reading(CommandInfo *information);
 
+int history_logOpen(CommandInfo *information);
+int history_logAppend(CommandInfo *information, char *command);
+int history_logSync(CommandInfo *information);
+int history_logPrint(CommandInfo *information);
+void history_logClose(CommandInfo *information);
+
+int history_logMap(HistoryLog *log);
+int history_logRotate(HistoryLog *log);
+HistoryRecord *history_logNext(HistoryLog *log, unsigned long *offset);
+unsigned long history_logClaim(HistoryLog *log, unsigned long size);
+
+int history_indexAdd(HistoryIndex **indexPtr, const char *entry);
+HistoryPosting *history_indexPosting(HistoryIndex *index,
+									 unsigned int key, int create);
+void history_indexFree(HistoryIndex **indexPtr);
+void history_indexDrop(HistoryIndex *index, size_t keep);
+
+int history_indexSearch(HistoryIndex *index, const char *query,
+						int before, int prefix);
+const char *history_indexSuggest(HistoryIndex *index, const char *prefix);
+
 
 /* some other */
 char *duplicate_characters(const char *path_str, int first, int end);
@@ -287,10 +1257,251 @@ char *find_command_path(CommandInfo *information,
 
 
 
+/* string builder */
+int builder_reserve(StringBuilder *builder, size_t extra);
+int builder_append(StringBuilder *builder, const char *text, size_t length);
+int builder_appendChar(StringBuilder *builder, char character);
+int builder_insert(StringBuilder *builder, size_t position,
+				   const char *text, size_t length);
+void builder_erase(StringBuilder *builder, size_t position, size_t length);
+
+/* line editor */
+int editor_isAvailable(CommandInfo *information);
+ssize_t editor_readLine(CommandInfo *information, char **buffer,
+						size_t *buffer_size, const char *prompt);
+void editor_free(CommandInfo *information);
+
+int editor_processByte(CommandInfo *information,
+					   LineEditor *editor, unsigned char byte);
+int editor_processKey(CommandInfo *information, LineEditor *editor, int key);
+
+void editor_insert(LineEditor *editor, const char *text, size_t length);
+void editor_kill(LineEditor *editor, size_t from, size_t to);
+size_t editor_step(LineEditor *editor, size_t position, int direction);
+size_t editor_word(LineEditor *editor, size_t position, int direction);
+
+void editor_recall(CommandInfo *information, LineEditor *editor,
+				   int direction);
+void editor_render(LineEditor *editor);
+void editor_moveTo(LineEditor *editor, size_t from, size_t to);
+size_t editor_width(const char *text, size_t length);
+
+int editor_searchKey(CommandInfo *information, LineEditor *editor, int key);
+void editor_search(CommandInfo *information, LineEditor *editor, int older);
+void editor_suggest(CommandInfo *information, LineEditor *editor);
+void editor_prompt(LineEditor *editor);
+
+/* completion */
+int completion_add(CompletionList *list, const char *name, size_t length);
+int completion_readDirectory(CompletionList *list, const char *path,
+							 int executables);
+void completion_sort(CompletionList *list);
+void completion_clear(CompletionList *list);
+CompletionIndex *completion_refresh(CommandInfo *information);
+void completion_invalidate(CommandInfo *information);
+CompletionList *completion_files(CompletionIndex *index,
+								 const char *directory);
+size_t completion_range(CompletionList *list, const char *prefix,
+						size_t length, size_t *first);
+void editor_complete(CommandInfo *information, LineEditor *editor);
+
+/* variables */
+size_t variable_nameLength(const char *text, size_t limit);
+const char *variable_get(CommandInfo *information, const char *name,
+						 size_t length);
+StringList *variable_environment(CommandInfo *information, const char *name,
+								 size_t length);
+int variable_set(CommandInfo *information, const char *name, size_t length,
+				 char *value);
+int variable_export(CommandInfo *information, const char *name,
+					size_t length, char *value);
+ShellVariable *variable_find(CommandInfo *information, const char *name,
+							 size_t length);
+ShellVariable *variable_insert(CommandInfo *information, const char *name,
+							   size_t length);
+void variable_remove(CommandInfo *information, const char *name,
+					 size_t length);
+void variable_readonly(CommandInfo *information, const char *name,
+					   size_t length);
+void variable_free(CommandInfo *information);
+unsigned long variable_hash(const char *name, size_t length);
+int variable_prefix(char **words);
+int variable_assignWord(CommandInfo *information, char *word);
+int variable_assign(CommandInfo *information);
+int declare_command(CommandInfo *information);
+int variable_unsetElement(CommandInfo *information, char *word);
+
+/* arrays */
+long array_findKey(ShellArray *array, const char *key, size_t length);
+int array_setIndex(ShellArray *array, size_t index, char *value);
+int array_setKey(ShellArray *array, const char *key, size_t length,
+				 char *value);
+ShellArray *array_of(ShellVariable *variable, int associative);
+void array_clear(ShellVariable *variable);
+char *array_key(CommandInfo *information, const char *subscript,
+				size_t length);
+int array_index(CommandInfo *information, ShellVariable *variable,
+				const char *subscript, size_t length, size_t *index);
+const char *array_element(CommandInfo *information, ShellVariable *variable,
+						  const char *subscript, size_t length);
+int array_assign(CommandInfo *information, ShellVariable *variable,
+				 const char *subscript, size_t length, const char *value,
+				 int append);
+const char *array_next(ShellVariable *variable, size_t *position, int keys,
+					   char *scratch);
+size_t array_subscript(const char *text, size_t limit);
+size_t array_all(const char *name, size_t length);
+const char *array_lookup(CommandInfo *information, const char *name,
+						 size_t length);
+int array_count(CommandInfo *information, const char *name, size_t length,
+				size_t *count);
+int array_expand(CommandInfo *information, StringBuilder *output,
+				 const char *name, size_t length, int keys);
+const char *array_each(CommandInfo *information, StringBuilder *output,
+					   const char *name, size_t length, size_t *position,
+					   char *scratch);
+int array_slice(CommandInfo *information, StringBuilder *output,
+				const char *name, size_t length, long start, long count);
+int array_compound(CommandInfo *information, const char *name,
+				   size_t length, const char *text, int append);
+int overlay_split(CommandInfo *information);
+char **overlay_environment(CommandInfo *information);
+char *overlay_get(CommandInfo *information, const char *name);
+int export_command(CommandInfo *information);
+int readonly_command(CommandInfo *information);
+int unset_command(CommandInfo *information);
+
+/* parameter expansion */
+size_t expand_nameLength(const char *text, size_t limit);
+const char *expand_lookup(CommandInfo *information, const char *name,
+						  size_t length, char *scratch);
+long expand_closing(const char *text, size_t limit);
+void expand_length(CommandInfo *information, StringBuilder *output,
+				   const char *name, size_t length);
+void expand_text(CommandInfo *information, StringBuilder *output,
+				 const char *text, size_t limit);
+char *expand_word(CommandInfo *information, char *word);
+size_t expand_separator(const char *text, size_t limit, char separator);
+int expand_compile(CommandInfo *information, GlobPattern *pattern,
+				   const char *text, size_t limit);
+const char *expand_value(CommandInfo *information, const char *name,
+						 size_t length, char *scratch);
+void expand_substring(CommandInfo *information, StringBuilder *output,
+					  const char *name, size_t length,
+					  const char *text, size_t limit);
+size_t expand_arithmetic(CommandInfo *information, StringBuilder *output,
+						 const char *text, size_t limit);
+int expand_modifier(CommandInfo *information, StringBuilder *output,
+					const char *name, size_t length,
+					const char *text, size_t limit);
+void expand_command(CommandInfo *information, StringBuilder *output,
+					const char *text, size_t length);
+
+/* glob patterns */
+int glob_compile(GlobPattern *pattern, const char *text, size_t length);
+void glob_free(GlobPattern *pattern);
+long glob_prefix(GlobPattern *pattern, const char *text, size_t length,
+				 int longest);
+int glob_match(GlobPattern *pattern, const char *text, size_t length);
+int glob_isPattern(const char *text, size_t length);
+void glob_sort(CompletionList *list);
+CompletionList *glob_directory(GlobDirectory **cache, const char *path);
+void glob_forget(GlobDirectory **cache);
+void glob_walk(GlobDirectory **cache, StringBuilder *path,
+			   const char *pattern, CompletionList *matches);
+int glob_expand(GlobDirectory **cache, const char *word,
+				CompletionList *matches);
+int glob_replacer(CommandInfo *information);
+
+/* arithmetic */
+long arith_emit(ArithParser *parser, int code, long value, size_t length);
+int arith_unary(ArithParser *parser);
+int arith_parse(ArithParser *parser, int min);
+size_t arith_number(const char *text, size_t limit, long *value);
+int arith_run(CommandInfo *information, ArithProgram *program,
+			  long *result, const char **error);
+int arith_evaluate(CommandInfo *information, const char *text,
+				   size_t length, long *value);
+int arith_command(CommandInfo *information);
+void arith_free(CommandInfo *information);
+
+/* syntax */
+size_t syntax_skip(const char *text, size_t position, size_t length);
+char **syntax_split(char *text);
+int syntax_command(const char *text, size_t position);
+size_t syntax_group(const char *text, size_t position, size_t length);
+int syntax_compound(const char *word);
+void syntax_newlines(char *text, size_t length);
+int group_command(CommandInfo *information);
+
+/* case statements */
+size_t syntax_case(const char *text, size_t position, size_t length);
+ssize_t case_continue(CommandInfo *information, char **buffer);
+void case_classes(CaseProgram *program);
+void case_closure(CaseProgram *program, unsigned long *set);
+long case_add(CaseProgram *program, const unsigned long *set);
+void case_match(CaseProgram *program, const char *word, size_t length,
+				char *matched);
+int case_parse(CaseProgram *program, size_t *patterns, size_t *count);
+int case_nfa(CommandInfo *information, CaseProgram *program,
+			 const size_t *patterns, size_t count);
+int case_compile(CommandInfo *information, CaseProgram *program,
+				 const char *text, size_t length);
+void case_release(CaseProgram *program);
+int case_command(CommandInfo *information);
+void case_free(CommandInfo *information);
+
+/* conditional expressions */
+size_t syntax_condition(const char *text, size_t position, size_t length);
+int condition_command(CommandInfo *information);
+int condition_group(CommandInfo *information, ConditionParser *parser,
+					const char *text, size_t length, int run);
+int condition_or(CommandInfo *information, ConditionParser *parser, int run);
+void condition_error(CommandInfo *information, ConditionParser *parser);
+char *condition_operand(CommandInfo *information, const char *word);
+int condition_unary(CommandInfo *information, const char *operator,
+					const char *word);
+int condition_binary(CommandInfo *information, ConditionParser *parser,
+					 const char *left, const char *operator,
+					 const char *right);
+int regex_match(CommandInfo *information, const char *text,
+				const char *pattern);
+void regex_free(CommandInfo *information);
+
+/* scripts */
+void script_run(CommandInfo *information);
+int script_atEnd(int descriptor);
+
+/* descriptors */
+int descriptor_keep(int *owner);
+void descriptor_release(int *owner);
+int descriptor_isShell(int descriptor);
+int descriptor_free(int descriptor);
+
+/* zygote */
+void zygote_serve(int socket);
+void zygote_start(CommandInfo *information);
+int zygote_launch(CommandInfo *information);
+
+/* executable cache */
+int executable_open(CommandInfo *information);
+void executable_free(CommandInfo *information);
+
+/* exec */
+void command_exec(CommandInfo *information);
+void exec_replace(CommandInfo *information);
+int exec_command(CommandInfo *information);
+
 /* execution builtin */
 int executeBuiltIn(CommandInfo *information);
+int builtin_captured(char *name);
+int echo_command(CommandInfo *information);
+int printf_command(CommandInfo *information);
+void output_format(StringBuilder *output, const char *format, size_t length,
+				   const char *text, long number);
 
 /* main */
 void handleSigInt(__attribute__((unused))int sigNum);
+void child_exit(CommandInfo *information, int result);
 
 #endif /* SHELL_H*/
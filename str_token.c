@@ -27,14 +27,13 @@ char **tokenizeString(char *str_in, char *delimiter)
 	for (w = 0; str_in[w] != '\0'; w++)
 		if (!IfInDelimiterSet(str_in[w], delimiter) &&
 			(IfInDelimiterSet(str_in[w + 1], delimiter) || !str_in[w + 1]))
-		{
 			n++;
-		}
 	if (n == 0)
 		return (NULL);
 	tokenArray = malloc((1 + n) * sizeof(char *));
 	if (!tokenArray)
 		return (NULL);
+	shell_counters[COUNTER_ALLOCATIONS] += 1 + n;
 	for (w = 0, x = 0; x < n; x++)
 	{
 		while (IfInDelimiterSet(str_in[w], delimiter))
@@ -93,6 +92,7 @@ char **tokenizeString_D(char *str_in, char delimiter)
 	tokenArray = malloc((1 + n) * sizeof(char *));
 	if (!tokenArray)
 		return (NULL);
+	shell_counters[COUNTER_ALLOCATIONS] += 1 + n;
 	for (w = 0, x = 0; x < n; x++)
 	{
 		while (str_in[w] == delimiter && str_in[w] != delimiter)
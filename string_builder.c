@@ -0,0 +1,129 @@
+#include "shell.h"
+
+/**
+* builder_reserve - function makes room for more characters in a builder.
+*
+* The capacity grows geometrically, so appending one character at a time
+* costs amortised constant time. The data is always kept NUL terminated.
+*
+* @builder: Pointer to the string builder.
+* @extra: Number of characters about to be added.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int builder_reserve(StringBuilder *builder, size_t extra)
+{
+	size_t capacity = builder->capacity ? builder->capacity : 64;
+	char *data;
+
+	/* Step 1: Nothing to do if the characters and the NUL already fit */
+	if (builder->length + extra + 1 <= builder->capacity)
+		return (0);
+
+	/* Step 2: Double the capacity until everything fits */
+	while (capacity < builder->length + extra + 1)
+		capacity *= 2;
+	data = realloc_Memory(builder->data, builder->capacity, capacity);
+	if (!data)
+		return (-1);
+	if (!builder->data)
+		data[0] = '\0';
+
+	/* Step 3: Keep the new buffer */
+	builder->data = data;
+	builder->capacity = capacity;
+	return (0);
+}
+
+/**
+* builder_append - function appends characters to a builder.
+*
+* @builder: Pointer to the string builder.
+* @text: The characters to append.
+* @length: Number of characters to append.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int builder_append(StringBuilder *builder, const char *text, size_t length)
+{
+	size_t i;
+
+	if (builder_reserve(builder, length) == -1)
+		return (-1);
+	for (i = 0; i < length; i++)
+		builder->data[builder->length + i] = text[i];
+	builder->length += length;
+	builder->data[builder->length] = '\0';
+	return (0);
+}
+
+/**
+* builder_appendChar - function appends a single character to a builder.
+*
+* @builder: Pointer to the string builder.
+* @character: The character to append.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int builder_appendChar(StringBuilder *builder, char character)
+{
+	if (builder->length + 2 > builder->capacity &&
+		builder_reserve(builder, 1) == -1)
+		return (-1);
+	builder->data[builder->length++] = character;
+	builder->data[builder->length] = '\0';
+	return (0);
+}
+
+/**
+* builder_insert - function inserts characters in the middle of a builder.
+*
+* @builder: Pointer to the string builder.
+* @position: Index at which the characters are inserted.
+* @text: The characters to insert.
+* @length: Number of characters to insert.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+int builder_insert(StringBuilder *builder, size_t position,
+				   const char *text, size_t length)
+{
+	size_t i;
+
+	if (position > builder->length)
+		position = builder->length;
+	if (builder_reserve(builder, length) == -1)
+		return (-1);
+
+	/* Step 1: Shift the tail, including the NUL, to the right */
+	for (i = builder->length + 1; i-- > position;)
+		builder->data[i + length] = builder->data[i];
+
+	/* Step 2: Copy the new characters into the gap */
+	for (i = 0; i < length; i++)
+		builder->data[position + i] = text[i];
+	builder->length += length;
+	return (0);
+}
+
+/**
+* builder_erase - function removes characters from a builder.
+*
+* @builder: Pointer to the string builder.
+* @position: Index of the first character to remove.
+* @length: Number of characters to remove.
+*/
+void builder_erase(StringBuilder *builder, size_t position, size_t length)
+{
+	size_t i;
+
+	if (position >= builder->length)
+		return;
+	if (length > builder->length - position)
+		length = builder->length - position;
+
+	/* Shift the tail, including the NUL, to the left */
+	for (i = position; i + length <= builder->length; i++)
+		builder->data[i] = builder->data[i + length];
+	builder->length -= length;
+}
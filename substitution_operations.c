@@ -0,0 +1,159 @@
+#include "shell.h"
+
+StringBuilder *output_capture;
+
+/**
+* substitution_captured - function tells whether a command substitution
+* may run in the shell process.
+*
+* Every command must be a builtin that only prints and not an alias, and
+* no expansion may assign a variable, or the changes a child would have
+* made would stay in the shell.
+*
+* @information: Pointer to the command information structure.
+* @text: The commands.
+*
+* Return: 1 if it may, 0 otherwise.
+*/
+static int substitution_captured(CommandInfo *information, const char *text)
+{
+	size_t length = str_length((char *)text), i, end, word;
+	char name[16];
+	int first = 1;
+
+	for (i = 0; i < length; i++)
+	{
+		if (first && !IfInDelimiterSet(text[i], " \t"))
+		{
+			for (word = 0; i + word < length &&
+				 !IfInDelimiterSet(text[i + word], " \t;&|"); word++)
+				;
+			if (word >= sizeof(name))
+				return (0);
+			str_n_copy(name, (char *)text + i, word + 1);
+			if (!builtin_captured(name) ||
+				findNodeWithPrefix(information->command_alias, name, '='))
+				return (0);
+			first = 0;
+		}
+		for (end = syntax_skip(text, i, length); i < end; i++)
+			if (text[i] == '=' || ((text[i] == '+' || text[i] == '-') &&
+								   text[i + 1] == text[i]))
+				return (0);
+		if (IfInDelimiterSet(text[i], ";&|"))
+			first = 1;
+	}
+	return (1);
+}
+
+/**
+* substitution_collect - function reads the output of a command
+* substitution to its end.
+*
+* The output is read straight into the free room of @output, grown
+* geometrically as it fills, so it is never copied again.
+*
+* @descriptor: The reading end of the pipe.
+* @output: Pointer to the buffer to append to.
+*/
+static void substitution_collect(int descriptor, StringBuilder *output)
+{
+	ssize_t count = 1;
+
+	while (count > 0 && builder_reserve(output, SUBSTITUTION_READ) == 0)
+	{
+		count = read(descriptor, output->data + output->length,
+					 output->capacity - output->length - 1);
+		if (count > 0)
+			output->length += count;
+		else if (count == -1 && errno == EINTR)
+			count = 1;
+	}
+}
+
+/**
+* substitution_read - function runs a command substitution in a child and
+* appends its output.
+*
+* @information: Pointer to the command information structure.
+* @text: The commands.
+* @output: Pointer to the buffer to append to.
+*/
+static void substitution_read(CommandInfo *information, char *text,
+							  StringBuilder *output)
+{
+	int pipes[2], status;
+	struct rusage usage;
+	pid_t child;
+
+	print_char(BUFFER_F);
+	error_print_char(BUFFER_F);
+	if (pipe(pipes) == -1)
+	{
+		perror("Error:");
+		return;
+	}
+	child = fork();
+	shell_counters[COUNTER_FORKS]++;
+	if (child == 0)
+	{
+		output_capture = NULL;
+		information->subshell = 1;
+		close(pipes[0]);
+		if (pipes[1] != STDOUT_FILENO)
+			dup2(pipes[1], STDOUT_FILENO), close(pipes[1]);
+		child_exit(information, command_runList(information, text));
+	}
+	close(pipes[1]);
+	if (child != -1)
+		substitution_collect(pipes[0], output);
+	close(pipes[0]);
+	if (child == -1)
+	{
+		perror("Error:");
+		return;
+	}
+	wait4(child, &status, 0, &usage);
+	time_addUsage(information, &usage);
+	information->execution_status = WIFEXITED(status) ?
+		WEXITSTATUS(status) : 128 + WTERMSIG(status);
+}
+
+/**
+* expand_command - function appends the output of a command substitution.
+*
+* A substitution made only of builtins that print runs in the shell
+* process, its output collected by print_char; any other runs in a child.
+* Trailing newlines are dropped by shortening @output in place.
+*
+* @information: Pointer to the command information structure.
+* @output: Pointer to the buffer to append to.
+* @text: The commands, not NUL terminated.
+* @length: Length of @text.
+*/
+void expand_command(CommandInfo *information, StringBuilder *output,
+					const char *text, size_t length)
+{
+	StringBuilder *saved = output_capture;
+	size_t start = output->length;
+	char *body = malloc(length + 1);
+
+	if (!body)
+		return;
+	str_n_copy(body, (char *)text, length + 1);
+	shell_counters[COUNTER_SUBSTITUTIONS]++;
+	if (substitution_captured(information, body))
+	{
+		shell_counters[COUNTER_CAPTURED]++;
+		output_capture = output;
+		command_runList(information, body);
+		output_capture = saved;
+	}
+	else
+		substitution_read(information, body, output);
+	free(body);
+	while (output->length > start && output->data[output->length - 1] == '\n')
+		output->length--;
+	if (output->data)
+		output->data[output->length] = '\0';
+}
@@ -0,0 +1,127 @@
+#include "shell.h"
+
+/**
+* syntax_skip - function skips a nested construct.
+*
+* "(...)", "$(...)", "${...}", "`...`", "case ... esac", "[[ ... ]]" and
+* "{ ...; }" may contain blanks, ';', "&&" and "||" that do not end a word or a command,
+* so both the word splitter and the command chain splitter step over them
+* whole. Parentheses and braces are counted together.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+* @length: Length of the line.
+*
+* Return: Index of the character closing the construct starting at
+* @position, or @position if none starts there or it is not closed.
+*/
+size_t syntax_skip(const char *text, size_t position, size_t length)
+{
+	size_t i, depth = 0;
+
+	if (text[position] == 'c')
+	{
+		i = syntax_case(text, position, length);
+		return (i && i < length ? i : position);
+	}
+	if (text[position] == '{')
+	{
+		i = syntax_group(text, position, length);
+		return (i && i < length ? i : position);
+	}
+	if (text[position] == '[')
+	{
+		i = syntax_condition(text, position, length);
+		return (i && i < length ? i : position);
+	}
+	if (text[position] == '`')
+	{
+		for (i = position + 1; i < length && text[i] && text[i] != '`'; i++)
+			;
+		return (i < length && text[i] ? i : position);
+	}
+	if (text[position] != '(' && (text[position] != '$' ||
+		position + 1 >= length ||
+		(text[position + 1] != '(' && text[position + 1] != '{')))
+		return (position);
+	for (i = position; i < length && text[i]; i++)
+	{
+		if (text[i] == '(' || (text[i] == '{' && i && text[i - 1] == '$'))
+			depth++;
+		else if ((text[i] == ')' || text[i] == '}') && depth && !--depth)
+			return (i);
+	}
+	return (position);
+}
+
+/**
+* syntax_words - function finds the words of a command.
+*
+* @text: The command.
+* @words: Receives the start and the length of every word, may be NULL.
+*
+* Return: Number of words.
+*/
+static size_t syntax_words(const char *text, size_t *words)
+{
+	size_t length = str_length((char *)text), i = 0, start, count = 0;
+
+	while (i < length)
+	{
+		while (i < length && (text[i] == ' ' || text[i] == '\t'))
+			i++;
+		if (i == length)
+			break;
+		for (start = i; i < length && text[i] != ' ' && text[i] != '\t'; i++)
+			i = syntax_skip(text, i, length);
+		if (words)
+		{
+			words[2 * count] = start;
+			words[2 * count + 1] = i - start;
+		}
+		count++;
+	}
+	return (count);
+}
+
+/**
+* syntax_split - function splits a command into words.
+*
+* Words are separated by blanks, except inside "$((...))", "((...))",
+* "$(...)", "${...}" and "`...`", so an expression such as "$(( i + 1 ))"
+* stays one word.
+*
+* @text: The command.
+*
+* Return: NULL terminated array of words, or NULL if there are none or
+* memory allocation fails.
+*/
+char **syntax_split(char *text)
+{
+	size_t count, i, *words;
+	char **array;
+
+	if (!text)
+		return (NULL);
+	count = syntax_words(text, NULL);
+	if (!count)
+		return (NULL);
+	words = malloc(sizeof(size_t) * 2 * count);
+	array = malloc(sizeof(char *) * (count + 1));
+	if (!words || !array)
+		return (free(words), free(array), NULL);
+	syntax_words(text, words);
+	shell_counters[COUNTER_ALLOCATIONS] += 1 + count;
+	for (i = 0; i < count; i++)
+	{
+		array[i] = malloc(words[2 * i + 1] + 1);
+		if (!array[i])
+			break;
+		str_n_copy(array[i], text + words[2 * i], words[2 * i + 1] + 1);
+	}
+	array[i] = NULL;
+	free(words);
+	if (i < count)
+		return (freeStringArray(array), NULL);
+	return (array);
+}
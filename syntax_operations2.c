@@ -0,0 +1,96 @@
+#include "shell.h"
+
+/**
+* syntax_command - function tells whether a command may start at a
+* position, so that a word there is a reserved word.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+*
+* Return: 1 if it is first on the line, or follows ';', '&', '|', a
+* parenthesis, a '{', a newline or the NUL a command chain was cut at,
+* blanks aside; 0 otherwise.
+*/
+int syntax_command(const char *text, size_t position)
+{
+	size_t i;
+
+	for (i = position; i && IfInDelimiterSet(text[i - 1], " \t"); i--)
+		;
+	return (!i || !text[i - 1] || IfInDelimiterSet(text[i - 1], "\n;&|(){"));
+}
+
+/**
+* syntax_group - function finds the end of a "{ list; }" group or a
+* "( list )" subshell.
+*
+* The '}' closing a group must stand where a command may start, after a
+* ';' or a newline; a "((" starts an arithmetic command, not a subshell.
+*
+* @text: The line.
+* @position: Index of a character of the line.
+* @length: Length of the line.
+*
+* Return: Index of the closing '}' or ')', @length if the group is not
+* closed, or 0 if none starts at @position.
+*/
+size_t syntax_group(const char *text, size_t position, size_t length)
+{
+	char open = text[position], close = open == '{' ? '}' : ')';
+	size_t i;
+
+	if ((open != '{' && open != '(') || !syntax_command(text, position) ||
+		(position + 1 < length && (open == '(' ? text[position + 1] == '(' :
+		!IfInDelimiterSet(text[position + 1], " \t\n"))))
+		return (0);
+	for (i = position + 1; i < length && text[i]; i++)
+	{
+		if (text[i] == close && (open == '(' || (syntax_command(text, i) &&
+			(i + 1 == length || IfInDelimiterSet(text[i + 1],
+												 " \t\n;&|)")))))
+			return (i);
+		i = syntax_skip(text, i, length);
+	}
+	return (length);
+}
+
+/**
+* syntax_compound - function tells whether a word is a whole compound
+* command, which expands its own parts as it runs them.
+*
+* @word: The first word of a command.
+*
+* Return: 1 for a case statement, a "[[ ... ]]" test, a group or a
+* subshell, 0 otherwise.
+*/
+int syntax_compound(const char *word)
+{
+	size_t length = str_length((char *)word);
+
+	return (syntax_case(word, 0, length) || syntax_condition(word, 0, length)
+			|| syntax_group(word, 0, length));
+}
+
+/**
+* syntax_newlines - function makes the newlines of a multi-line list
+* separate its commands as ';' does.
+*
+* A newline after an operator, or before any command, only separates
+* words.
+*
+* @text: The list, changed in place.
+* @length: Length of the list.
+*/
+void syntax_newlines(char *text, size_t length)
+{
+	size_t i;
+	char last = ';';
+
+	for (i = 0; i < length; i = syntax_skip(text, i, length) + 1)
+	{
+		if (text[i] == '\n')
+			text[i] = IfInDelimiterSet(last, ";&|") ? ' ' : ';';
+		if (!IfInDelimiterSet(text[i], " \t"))
+			last = text[i];
+	}
+}
@@ -0,0 +1,4 @@
+echo x=$x
+echo FOO=$FOO
+echo E=$E
+alias
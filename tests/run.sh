@@ -0,0 +1,16 @@
+#!/bin/sh
+# Runs every tests/*.hsh with the shell given, from the tests directory,
+# and compares what it prints with the matching .out file.
+
+shell=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+cd "$(dirname "$0")" || exit 1
+failed=0
+for script in *.hsh; do
+	if "$shell" "$script" 2>&1 | diff -u "${script%.hsh}.out" -; then
+		echo "PASS $script"
+	else
+		echo "FAIL $script"
+		failed=1
+	fi
+done
+exit $failed
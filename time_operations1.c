@@ -0,0 +1,128 @@
+#include "shell.h"
+
+/**
+* time_appendDuration - function appends a duration as "1m2.345s".
+*
+* @output: Pointer to the buffer to append to.
+* @seconds: Whole seconds of the duration.
+* @microseconds: Microseconds of the duration.
+* @posix: 1 for the POSIX format, seconds only: "62.34".
+*/
+void time_appendDuration(StringBuilder *output, long seconds,
+						 long microseconds, int posix)
+{
+	char *number;
+
+	if (!posix)
+	{
+		number = conver_longInt_str(seconds / 60, 10, 0);
+		builder_append(output, number, str_length(number));
+		builder_appendChar(output, 'm');
+		seconds %= 60;
+	}
+	number = conver_longInt_str(seconds, 10, 0);
+	builder_append(output, number, str_length(number));
+	builder_appendChar(output, '.');
+	number = conver_longInt_str(microseconds / (posix ? 10000 : 1000) +
+								(posix ? 100 : 1000), 10, 0);
+	builder_append(output, number + 1, str_length(number + 1));
+	if (!posix)
+		builder_appendChar(output, 's');
+}
+
+/**
+* time_start - function starts timing for the time keyword.
+*
+* "time" (and its -p option) is removed from the argument vector, and the
+* rest of the command runs as usual. The measurement covers every command
+* up to the end of the && / || chain, and is reported by time_report.
+*
+* @information: Pointer to the command information structure.
+*/
+void time_start(CommandInfo *information)
+{
+	char **arguments = information->arguments_array;
+	int skip = 1, i;
+
+	if (arguments[1] && str_compare(arguments[1], "-p") == 0)
+		skip = 2;
+	if (!information->timing)
+	{
+		information->timing = malloc(sizeof(CommandTiming));
+		if (information->timing)
+		{
+			fillMemoryBlock((void *)information->timing, 0,
+							sizeof(CommandTiming));
+			clock_gettime(CLOCK_MONOTONIC, &information->timing->start);
+			getrusage(RUSAGE_SELF, &information->timing->self);
+			information->timing->posix = skip == 2;
+		}
+	}
+	for (i = 0; i < skip; i++)
+		free(arguments[i]);
+	i = 0;
+	do {
+		arguments[i] = arguments[i + skip];
+	} while (arguments[i++]);
+	information->argument_count -= skip;
+}
+
+/**
+* time_report - function prints the measurement of the time keyword.
+*
+* CPU times, faults and context switches add up the commands run by the
+* shell itself (builtins) and its children; the maximum RSS is the
+* largest of them. The report goes to standard error.
+*
+* @information: Pointer to the command information structure.
+*/
+void time_report(CommandInfo *information)
+{
+	CommandTiming *timing = information->timing;
+	struct rusage self, *children;
+	struct timespec now;
+	struct timeval times[3];
+	StringBuilder output = {NULL, 0, 0};
+	static const char * const labels[] = {"real", "user", "sys"};
+	int i;
+
+	if (!timing)
+		return;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	getrusage(RUSAGE_SELF, &self);
+	children = &timing->children;
+	times[0].tv_sec = now.tv_sec - timing->start.tv_sec;
+	times[0].tv_usec = (now.tv_nsec - timing->start.tv_nsec) / 1000;
+	if (times[0].tv_usec < 0)
+		times[0].tv_sec--, times[0].tv_usec += 1000000;
+	timersub(&self.ru_utime, &timing->self.ru_utime, &times[1]);
+	timeradd(&times[1], &children->ru_utime, &times[1]);
+	timersub(&self.ru_stime, &timing->self.ru_stime, &times[2]);
+	timeradd(&times[2], &children->ru_stime, &times[2]);
+	for (i = 0; i < 3; i++)
+	{
+		builder_append(&output, labels[i], str_length((char *)labels[i]));
+		builder_appendChar(&output, timing->posix ? ' ' : '\t');
+		time_appendDuration(&output, times[i].tv_sec, times[i].tv_usec,
+							timing->posix);
+		builder_appendChar(&output, '\n');
+	}
+	if (!timing->posix)
+		time_appendUsage(&output, &self, timing);
+	error_print_str(output.data);
+	error_print_char(BUFFER_F);
+	free(output.data);
+	free(timing);
+	information->timing = NULL;
+}
+
+/**
+* time_free - function drops an unfinished time measurement.
+*
+* @information: Pointer to the command information structure.
+*/
+void time_free(CommandInfo *information)
+{
+	free(information->timing);
+	information->timing = NULL;
+}
@@ -0,0 +1,88 @@
+#include "shell.h"
+
+/**
+* time_addUsage - function adds a reaped child to the timed usage.
+*
+* @information: Pointer to the command information structure.
+* @usage: Resource usage of the child, as returned by wait4().
+*/
+void time_addUsage(CommandInfo *information, struct rusage *usage)
+{
+	struct rusage *total;
+
+	if (!information->timing)
+		return;
+	total = &information->timing->children;
+	timeradd(&total->ru_utime, &usage->ru_utime, &total->ru_utime);
+	timeradd(&total->ru_stime, &usage->ru_stime, &total->ru_stime);
+	if (usage->ru_maxrss > total->ru_maxrss)
+		total->ru_maxrss = usage->ru_maxrss;
+	total->ru_minflt += usage->ru_minflt;
+	total->ru_majflt += usage->ru_majflt;
+	total->ru_nvcsw += usage->ru_nvcsw;
+	total->ru_nivcsw += usage->ru_nivcsw;
+}
+
+/**
+* time_appendUsage - function appends the resource usage lines of time.
+*
+* @output: Pointer to the buffer to append to.
+* @self: Resource usage of the shell now.
+* @timing: The measurement.
+*/
+void time_appendUsage(StringBuilder *output, struct rusage *self,
+					  CommandTiming *timing)
+{
+	struct rusage *start = &timing->self, *children = &timing->children;
+	long values[5];
+	static const char * const labels[] = {"maxrss\t", " KiB\nfaults\t",
+		" minor, ", " major\nswitches\t", " voluntary, "};
+	char *number;
+	int i;
+
+	values[0] = children->ru_maxrss > self->ru_maxrss ?
+				children->ru_maxrss : self->ru_maxrss;
+	values[1] = self->ru_minflt - start->ru_minflt + children->ru_minflt;
+	values[2] = self->ru_majflt - start->ru_majflt + children->ru_majflt;
+	values[3] = self->ru_nvcsw - start->ru_nvcsw + children->ru_nvcsw;
+	values[4] = self->ru_nivcsw - start->ru_nivcsw + children->ru_nivcsw;
+	for (i = 0; i < 5; i++)
+	{
+		builder_append(output, labels[i], str_length((char *)labels[i]));
+		number = conver_longInt_str(values[i], 10, 0);
+		builder_append(output, number, str_length(number));
+	}
+	builder_append(output, " involuntary\n", 13);
+}
+
+/**
+* times_command - function implements the times builtin.
+*
+* Prints the user and system CPU time used by the shell, then by all the
+* children it has waited for.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int times_command(CommandInfo *information)
+{
+	StringBuilder output = {NULL, 0, 0};
+	struct rusage usage;
+	int who;
+
+	(void)information;
+	for (who = 0; who < 2; who++)
+	{
+		getrusage(who ? RUSAGE_CHILDREN : RUSAGE_SELF, &usage);
+		time_appendDuration(&output, usage.ru_utime.tv_sec,
+							usage.ru_utime.tv_usec, 0);
+		builder_appendChar(&output, ' ');
+		time_appendDuration(&output, usage.ru_stime.tv_sec,
+							usage.ru_stime.tv_usec, 0);
+		builder_appendChar(&output, '\n');
+	}
+	print_str(output.data);
+	free(output.data);
+	return (0);
+}
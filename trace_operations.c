@@ -0,0 +1,165 @@
+#include "shell.h"
+
+static TraceSpan *trace_spans;	/* NULL while the tracer is disabled */
+static unsigned long trace_count;
+static unsigned long trace_origin;
+static char *trace_path;
+static pid_t trace_pid;
+
+/**
+* trace_open - function enables the tracer if HSH_TRACE is set.
+*
+* HSH_TRACE names the file the trace is written to at exit. The spans are
+* kept in a buffer allocated once here; nothing else is allocated while
+* tracing.
+*
+* @information: Pointer to the command information structure.
+*/
+void trace_open(CommandInfo *information)
+{
+	char *path = getEnvironmentVariable(information, "HSH_TRACE=");
+
+	if (!path || trace_spans)
+		return;
+	trace_path = str_duplicate(path);
+	trace_spans = malloc(sizeof(TraceSpan) * TRACE_CAPACITY);
+	if (!trace_path || !trace_spans)
+	{
+		free(trace_path);
+		free(trace_spans);
+		trace_spans = NULL;
+		return;
+	}
+	trace_pid = getpid();
+	trace_origin = trace_begin();
+}
+
+/**
+* trace_begin - function reads the clock at the start of a span.
+*
+* Return: The time in nanoseconds, or 0 when the tracer is disabled, so
+* the matching trace_end does nothing.
+*/
+unsigned long trace_begin(void)
+{
+	struct timespec now;
+
+	if (!trace_spans)
+		return (0);
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec * 1000000000UL + now.tv_nsec);
+}
+
+/**
+* trace_end - function records a span.
+*
+* The slot is claimed with an atomic increment, so recording never takes
+* a lock. Spans past TRACE_CAPACITY are counted but dropped.
+*
+* @phase: One of the TRACE_ constants.
+* @start: Value returned by trace_begin at the start of the span.
+* @line: Input line the command came from.
+*/
+void trace_end(int phase, unsigned long start, unsigned int line)
+{
+	unsigned long index;
+	TraceSpan *span;
+
+	if (!start || !trace_spans)
+		return;
+	index = __atomic_fetch_add(&trace_count, 1, __ATOMIC_RELAXED);
+	if (index >= TRACE_CAPACITY)
+		return;
+	span = &trace_spans[index];
+	span->start = start - trace_origin;
+	span->duration = trace_begin() - start;
+	span->phase = phase;
+	span->line = line;
+}
+
+/**
+* trace_appendEvent - function appends a span as a trace event.
+*
+* Chrome trace events count in microseconds; the nanoseconds are kept as
+* three decimals.
+*
+* @output: Pointer to the buffer to append to.
+* @span: The span.
+* @pid: Process id written in the event.
+*/
+static void trace_appendEvent(StringBuilder *output, TraceSpan *span,
+							  char *pid)
+{
+	static const char * const names[] = {"read", "parse", "tokenize",
+		"alias", "expand", "lookup", "fork", "wait", "builtin", "command"};
+	unsigned long values[2];
+	char *number;
+	int i;
+
+	builder_append(output, "{\"name\":\"", 9);
+	builder_append(output, names[span->phase],
+				   str_length((char *)names[span->phase]));
+	builder_append(output, "\",\"cat\":\"hsh\",\"ph\":\"X\",\"pid\":", 29);
+	builder_append(output, pid, str_length(pid));
+	builder_append(output, ",\"tid\":", 7);
+	builder_append(output, pid, str_length(pid));
+	values[0] = span->start;
+	values[1] = span->duration;
+	for (i = 0; i < 2; i++)
+	{
+		builder_append(output, i ? ",\"dur\":" : ",\"ts\":", i ? 7 : 6);
+		number = conver_longInt_str(values[i] / 1000, 10, 0);
+		builder_append(output, number, str_length(number));
+		number = conver_longInt_str(values[i] % 1000 + 1000, 10, 0);
+		builder_appendChar(output, '.');
+		builder_append(output, number + 1, 3);
+	}
+	builder_append(output, ",\"args\":{\"line\":", 16);
+	number = conver_longInt_str(span->line, 10, 0);
+	builder_append(output, number, str_length(number));
+	builder_append(output, "}}", 2);
+}
+
+/**
+* trace_write - function writes the trace as Chrome trace-event JSON.
+*
+* Only the shell that opened the tracer writes, never a forked child. The
+* file can be loaded in chrome://tracing or Perfetto.
+*/
+void trace_write(void)
+{
+	StringBuilder output = {NULL, 0, 0};
+	unsigned long count = trace_count, i;
+	char pid[24], *number;
+	int descriptor;
+
+	if (!trace_spans || getpid() != trace_pid)
+		return;
+	str_copy(pid, conver_longInt_str(trace_pid, 10, 0));
+	builder_append(&output, "{\"traceEvents\":[", 16);
+	for (i = 0; i < count && i < TRACE_CAPACITY; i++)
+	{
+		if (i)
+			builder_appendChar(&output, ',');
+		builder_append(&output, "\n", 1);
+		trace_appendEvent(&output, &trace_spans[i], pid);
+	}
+	builder_append(&output, "\n],\"displayTimeUnit\":\"ns\",", 26);
+	builder_append(&output, "\"otherData\":{\"dropped\":", 23);
+	number = conver_longInt_str(count > TRACE_CAPACITY ?
+								count - TRACE_CAPACITY : 0, 10, 0);
+	builder_append(&output, number, str_length(number));
+	builder_append(&output, "}}\n", 3);
+	descriptor = open(trace_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+					  0644);
+	if (descriptor != -1)
+	{
+		if (write(descriptor, output.data, output.length) == -1)
+			perror(trace_path);
+		close(descriptor);
+	}
+	free(output.data);
+	free(trace_spans);
+	free(trace_path);
+	trace_spans = NULL;
+}
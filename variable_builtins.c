@@ -0,0 +1,164 @@
+#include "shell.h"
+
+/**
+* variable_word - function checks a "NAME[=value]" argument of a builtin.
+*
+* @information: Pointer to the command information structure.
+* @word: The argument.
+* @assignment: Whether "=value" may follow the name.
+*
+* Return: Length of the name, 0 after reporting it if it is not a valid
+* one.
+*/
+static size_t variable_word(CommandInfo *information, char *word,
+							int assignment)
+{
+	size_t length = variable_nameLength(word, str_length(word));
+
+	if (length && (!word[length] || (assignment && word[length] == '=')))
+		return (length);
+	information->execution_status = 1;
+	printErrorMessage(information, word);
+	error_print_str(": not a valid identifier\n");
+	return (0);
+}
+
+/**
+* variable_list - function prints the exported or the readonly variables.
+*
+* @information: Pointer to the command information structure.
+* @readonly: 1 for the readonly variables, 0 for the exported ones.
+*/
+static void variable_list(CommandInfo *information, int readonly)
+{
+	VariableTable *table = information->variables;
+	ShellVariable *variable;
+	StringList *node;
+	const char *value;
+	size_t i;
+
+	for (node = information->environment_list; !readonly && node;
+		 node = node->next)
+		print_str("export "), print_str(node->string), print_char('\n');
+	for (i = 0; readonly && table && i < table->size; i++)
+		for (variable = table->buckets[i]; variable; variable = variable->next)
+		{
+			if (!(variable->flags & VARIABLE_READONLY))
+				continue;
+			print_str("readonly ");
+			print_str(variable->name);
+			value = variable_get(information, variable->name,
+								 variable->length);
+			if (value)
+				print_char('='), print_str((char *)value);
+			print_char('\n');
+		}
+}
+
+/**
+* export_command - function exports variables to the environment of the
+* commands run.
+*
+* "export NAME=value" assigns and exports, "export NAME" exports the
+* current value, and "export" or "export -p" lists the environment.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int export_command(CommandInfo *information)
+{
+	char **words = information->arguments_array + 1;
+	size_t length;
+
+	information->execution_status = 0;
+	if (*words && str_compare(*words, "-p") == 0)
+		words++;
+	if (!*words)
+		variable_list(information, 0);
+	for (; *words; words++)
+	{
+		length = variable_word(information, *words, 1);
+		if (length && variable_export(information, *words, length,
+									  (*words)[length] ? *words + length + 1 :
+									  NULL))
+			information->execution_status = 1;
+	}
+	return (0);
+}
+
+/**
+* readonly_command - function makes variables readonly.
+*
+* "readonly NAME=value" assigns first. "readonly" or "readonly -p" lists
+* the readonly variables.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int readonly_command(CommandInfo *information)
+{
+	char **words = information->arguments_array + 1;
+	ShellVariable *variable;
+	size_t length;
+
+	information->execution_status = 0;
+	if (*words && str_compare(*words, "-p") == 0)
+		words++;
+	if (!*words)
+		variable_list(information, 1);
+	for (; *words; words++)
+	{
+		length = variable_word(information, *words, 1);
+		if (!length || ((*words)[length] && variable_set(information, *words,
+							length, *words + length + 1)))
+			continue;
+		variable = variable_insert(information, *words, length);
+		if (!variable)
+			continue;
+		if (!variable->value && !(variable->flags & VARIABLE_EXPORTED) &&
+			variable_environment(information, *words, length))
+			variable->flags |= VARIABLE_EXPORTED;
+		variable->flags |= VARIABLE_READONLY;
+	}
+	return (0);
+}
+
+/**
+* unset_command - function unsets variables, shell and exported ones, and
+* array elements given as "NAME[subscript]".
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int unset_command(CommandInfo *information)
+{
+	char **words = information->arguments_array + 1;
+	ShellVariable *variable;
+	size_t length;
+
+	information->execution_status = 0;
+	if (*words && str_compare(*words, "-v") == 0)
+		words++;
+	for (; *words; words++)
+	{
+		if (variable_unsetElement(information, *words))
+			continue;
+		length = variable_word(information, *words, 0);
+		if (!length)
+			continue;
+		variable = variable_find(information, *words, length);
+		if (variable && variable->flags & VARIABLE_READONLY)
+		{
+			information->execution_status = 1;
+			printErrorMessage(information, *words);
+			error_print_str(": cannot unset: readonly variable\n");
+			continue;
+		}
+		variable_remove(information, *words, length);
+		unsetEnvironmentVariable(information, *words);
+	}
+	return (0);
+}
@@ -0,0 +1,201 @@
+#include "shell.h"
+
+/**
+* declare_options - function reads an option word of declare.
+*
+* @information: Pointer to the command information structure.
+* @word: The word, starting with '-'.
+* @flags: Receives VARIABLE_ARRAY, VARIABLE_ASSOCIATIVE,
+* VARIABLE_READONLY and VARIABLE_EXPORTED for -a, -A, -r and -x.
+* @print: Set to 1 for -p.
+*
+* Return: 0 on success, -1 after reporting it for an unknown option.
+*/
+static int declare_options(CommandInfo *information, char *word, int *flags,
+						   int *print)
+{
+	char *option;
+
+	for (option = word + 1; *option; option++)
+	{
+		if (*option == 'a')
+			*flags |= VARIABLE_ARRAY;
+		else if (*option == 'A')
+			*flags |= VARIABLE_ASSOCIATIVE;
+		else if (*option == 'r')
+			*flags |= VARIABLE_READONLY;
+		else if (*option == 'x')
+			*flags |= VARIABLE_EXPORTED;
+		else if (*option == 'p')
+			*print = 1;
+		else
+		{
+			printErrorMessage(information, word);
+			error_print_str(": invalid option\n");
+			information->execution_status = 2;
+			return (-1);
+		}
+	}
+	return (0);
+}
+
+/**
+* declare_print - function prints a variable as a declare command.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: 0 on success, -1 if the variable does not exist.
+*/
+static int declare_print(CommandInfo *information, const char *name,
+						 size_t length)
+{
+	ShellVariable *variable = variable_find(information, name, length);
+	int flags = variable ? variable->flags : VARIABLE_EXPORTED, first = 1;
+	const char *value = variable_get(information, name, length), *key;
+	size_t position = 0, i;
+	char scratch[24];
+
+	if (!variable && !value)
+		return (-1);
+	print_str("declare -");
+	print_str(flags & VARIABLE_ARRAY ? "a" : flags &
+			  VARIABLE_ASSOCIATIVE ? "A" : "");
+	print_str(flags & VARIABLE_READONLY ? "r" : "");
+	print_str(flags & VARIABLE_EXPORTED ? "x" : "");
+	print_str(flags ? " " : "- ");
+	for (i = 0; i < length; i++)
+		print_char(name[i]);
+	if (variable && variable->array)
+		print_str("=(");
+	while (variable && variable->array &&
+		   (key = array_next(variable, &position, 1, scratch)))
+	{
+		value = flags & VARIABLE_ASSOCIATIVE ?
+				variable->array->entries[position - 1].value :
+				variable->array->items[position - 1];
+		print_str(first ? "[" : " ["), print_str((char *)key);
+		print_str("]=\""), print_str((char *)value), print_char('"');
+		first = 0;
+	}
+	if (variable && variable->array)
+		print_char(')');
+	else if (value)
+		print_str("=\""), print_str((char *)value), print_char('"');
+	print_char('\n');
+	return (0);
+}
+
+/**
+* declare_array - function makes a variable the array declare -a or -A
+* asks for.
+*
+* @information: Pointer to the command information structure.
+* @word: The argument.
+* @length: Length of the name at the start of @word.
+* @kind: VARIABLE_ARRAY or VARIABLE_ASSOCIATIVE.
+*
+* Return: 0 on success, -1 if the variable cannot be that array.
+*/
+static int declare_array(CommandInfo *information, char *word, size_t length,
+						 int kind)
+{
+	ShellVariable *variable = variable_insert(information, word, length);
+
+	if (!variable)
+		return (-1);
+	if (variable->flags & VARIABLE_READONLY)
+	{
+		variable_readonly(information, word, length);
+		return (-1);
+	}
+	if (variable->array && !(variable->flags & kind))
+	{
+		printErrorMessage(information, word);
+		error_print_str(kind == VARIABLE_ARRAY ?
+						": cannot convert associative to indexed array\n" :
+						": cannot convert indexed to associative array\n");
+		information->execution_status = 1;
+		return (-1);
+	}
+	return (array_of(variable, kind == VARIABLE_ASSOCIATIVE) ? 0 : -1);
+}
+
+/**
+* declare_word - function declares a "NAME[=value]" argument of declare.
+*
+* @information: Pointer to the command information structure.
+* @word: The argument.
+* @flags: The attributes given by the options.
+*/
+static void declare_word(CommandInfo *information, char *word, int flags)
+{
+	size_t length = variable_nameLength(word, str_length(word));
+	int kind = flags & (VARIABLE_ARRAY | VARIABLE_ASSOCIATIVE);
+	char *words[2];
+	ShellVariable *variable;
+
+	words[0] = word, words[1] = NULL;
+	if (!length || (word[length] && !variable_prefix(words)))
+	{
+		printErrorMessage(information, word);
+		error_print_str(": not a valid identifier\n");
+		information->execution_status = 1;
+		return;
+	}
+	if (kind && declare_array(information, word, length, kind) == -1)
+		return;
+	if (word[length] && variable_assignWord(information, word))
+		information->execution_status = 1;
+	if (flags & VARIABLE_EXPORTED)
+		variable_export(information, word, length, NULL);
+	variable = variable_insert(information, word, length);
+	if (!variable || !(flags & VARIABLE_READONLY))
+		return;
+	if (!variable->value && !variable->array &&
+		variable_environment(information, word, length))
+		variable->flags |= VARIABLE_EXPORTED;
+	variable->flags |= VARIABLE_READONLY;
+}
+
+/**
+* declare_command - function declares variables and gives them
+* attributes.
+*
+* "declare -a NAME" makes an indexed array, "declare -A NAME" an
+* associative one, -r makes readonly and -x exports. "declare -p NAME"
+* prints the variable, and "declare" alone all the shell variables.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: Always 0.
+*/
+int declare_command(CommandInfo *information)
+{
+	char **words = information->arguments_array + 1;
+	VariableTable *table = information->variables;
+	ShellVariable *variable;
+	int flags = 0, print = 0;
+	size_t i;
+
+	information->execution_status = 0;
+	for (; *words && (*words)[0] == '-' && (*words)[1]; words++)
+		if (declare_options(information, *words, &flags, &print) == -1)
+			return (0);
+	for (i = 0; !*words && table && i < table->size; i++)
+		for (variable = table->buckets[i]; variable; variable = variable->next)
+			declare_print(information, variable->name, variable->length);
+	for (; *words; words++)
+	{
+		if (!print)
+			declare_word(information, *words, flags);
+		else if (declare_print(information, *words, str_length(*words)) == -1)
+		{
+			printErrorMessage(information, *words);
+			error_print_str(": not found\n");
+			information->execution_status = 1;
+		}
+	}
+	return (0);
+}
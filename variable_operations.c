@@ -0,0 +1,176 @@
+#include "shell.h"
+
+/**
+* variable_nameLength - function measures the variable name at the start
+* of a string.
+*
+* A name is a letter or '_' followed by letters, digits and '_'.
+*
+* @text: The string.
+* @limit: Number of characters of @text that may be read.
+*
+* Return: Length of the name, 0 if @text does not start with one.
+*/
+size_t variable_nameLength(const char *text, size_t limit)
+{
+	size_t length = 0;
+
+	if (!limit || (!isAlphabeticCharacter(text[0]) && text[0] != '_'))
+		return (0);
+	while (length < limit && (isAlphabeticCharacter(text[length]) ||
+		   text[length] == '_' || (text[length] >= '0' && text[length] <= '9')))
+		length++;
+	return (length);
+}
+
+/**
+* variable_environment - function finds an exported variable.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: The "NAME=value" node of the environment list, or NULL.
+*/
+StringList *variable_environment(CommandInfo *information, const char *name,
+								 size_t length)
+{
+	StringList *node;
+	size_t i;
+
+	for (node = information->environment_list; node; node = node->next)
+	{
+		for (i = 0; i < length && node->string[i] == name[i]; i++)
+			;
+		if (i == length && node->string[i] == '=')
+			return (node);
+	}
+	return (NULL);
+}
+
+/**
+* variable_get - function looks up the value of a variable.
+*
+* Unlike getEnvironmentVariable, the name does not need to be NUL
+* terminated, so it can be looked up in place inside a word, and a
+* variable set to the empty string is told apart from an unset one. Shell
+* variables are found in their hash table, exported ones in the
+* environment list. An array gives its element 0.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: The value, or NULL if the variable is not set.
+*/
+const char *variable_get(CommandInfo *information, const char *name,
+						 size_t length)
+{
+	ShellVariable *variable = variable_find(information, name, length);
+	StringList *node;
+
+	if (variable && variable->array)
+		return (array_element(information, variable, "0", 1));
+	if (variable && !(variable->flags & VARIABLE_EXPORTED))
+		return (variable->value);
+	node = variable_environment(information, name, length);
+	return (node ? node->string + length + 1 : NULL);
+}
+
+/**
+* variable_set - function assigns a variable.
+*
+* A variable already exported is updated in the environment; any other
+* becomes, or stays, a shell variable, whose buffer is reused when the
+* new value fits. Assigning an array sets its element 0.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @value: The new value.
+*
+* Return: 0 on success, 1 if the variable is readonly or memory allocation
+* fails.
+*/
+int variable_set(CommandInfo *information, const char *name, size_t length,
+				 char *value)
+{
+	ShellVariable *variable = variable_find(information, name, length);
+	size_t size = str_length(value) + 1;
+	char *buffer;
+
+	if (variable && variable->flags & VARIABLE_READONLY)
+		return (variable_readonly(information, name, length), 1);
+	if (variable && variable->array)
+		return (array_assign(information, variable, "0", 1, value, 0));
+	if (variable ? variable->flags & VARIABLE_EXPORTED :
+		variable_environment(information, name, length) != NULL)
+		return (variable_export(information, name, length, value));
+	variable = variable_insert(information, name, length);
+	if (!variable)
+		return (1);
+	if (size > variable->capacity)
+	{
+		buffer = malloc(size);
+		if (!buffer)
+			return (1);
+		free(variable->value);
+		variable->value = buffer;
+		variable->capacity = size;
+	}
+	str_copy(variable->value, value);
+	return (0);
+}
+
+/**
+* variable_export - function moves a variable to the environment.
+*
+* Without a value, a shell variable is exported with its own value, and a
+* variable still unset is marked so that its first assignment exports it.
+* The shell variable is then dropped, unless it is readonly.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+* @value: The value to assign, or NULL to keep the current one.
+*
+* Return: 0 on success, 1 if the variable is readonly or memory allocation
+* fails.
+*/
+int variable_export(CommandInfo *information, const char *name,
+					size_t length, char *value)
+{
+	ShellVariable *variable = variable_find(information, name, length);
+	char *key;
+	int result = 0;
+
+	if (variable && value && variable->flags & VARIABLE_READONLY)
+		return (variable_readonly(information, name, length), 1);
+	if (!value && variable && !(variable->flags & VARIABLE_EXPORTED))
+		value = variable->value;
+	if (!value && !variable_environment(information, name, length))
+	{
+		variable = variable_insert(information, name, length);
+		if (!variable)
+			return (1);
+		variable->flags |= VARIABLE_EXPORTED;
+		return (0);
+	}
+	key = malloc(length + 1);
+	if (!key)
+		return (1);
+	str_n_copy(key, (char *)name, length + 1);
+	if (value)
+		result = setEnvironmentVariable(information, key, value);
+	free(key);
+	if (variable && variable->flags & VARIABLE_READONLY)
+	{
+		free(variable->value);
+		variable->value = NULL;
+		variable->capacity = 0;
+		variable->flags |= VARIABLE_EXPORTED;
+	}
+	else if (variable)
+		variable_remove(information, name, length);
+	return (result);
+}
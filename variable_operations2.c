@@ -0,0 +1,161 @@
+#include "shell.h"
+
+/**
+* variable_readonly - function reports an assignment to a readonly
+* variable.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*/
+void variable_readonly(CommandInfo *information, const char *name,
+					   size_t length)
+{
+	size_t i;
+
+	error_print_str(information->file_name);
+	error_print_str(": ");
+	print_int_fd(information->current_line, STDERR_FILENO);
+	error_print_str(": ");
+	for (i = 0; i < length; i++)
+		error_print_char(name[i]);
+	error_print_str(": readonly variable\n");
+	information->execution_status = 1;
+}
+
+/**
+* variable_free - function releases the shell variables.
+*
+* @information: Pointer to the command information structure.
+*/
+void variable_free(CommandInfo *information)
+{
+	VariableTable *table = information->variables;
+	ShellVariable *variable, *next;
+	size_t i;
+
+	if (!table)
+		return;
+	for (i = 0; i < table->size; i++)
+		for (variable = table->buckets[i]; variable; variable = next)
+		{
+			next = variable->next;
+			array_clear(variable);
+			free(variable->name);
+			free(variable->value);
+			free(variable);
+		}
+	free(table->buckets);
+	free(table);
+	information->variables = NULL;
+}
+
+/**
+* variable_prefix - function counts the assignments starting a command.
+*
+* It runs before expansion, so that only words written as "NAME=value",
+* "NAME+=value" or "NAME[subscript]=value" are assignments, not words
+* whose expansion looks like one.
+*
+* @words: The words of the command.
+*
+* Return: Number of leading assignment words.
+*/
+int variable_prefix(char **words)
+{
+	size_t length, size;
+	int count;
+
+	for (count = 0; words && words[count]; count++)
+	{
+		size = str_length(words[count]);
+		length = variable_nameLength(words[count], size);
+		if (length)
+			length += array_subscript(words[count] + length, size - length);
+		if (length && words[count][length] == '+')
+			length++;
+		if (!length || words[count][length] != '=')
+			break;
+	}
+	return (count);
+}
+
+/**
+* variable_assignWord - function runs one assignment word.
+*
+* "NAME=(...)" and "NAME+=(...)" are compound assignments of an array;
+* otherwise the value is expanded and assigned to the variable, or to
+* the element "NAME[subscript]", "+=" appending to the current value.
+*
+* @information: Pointer to the command information structure.
+* @word: The word, not expanded.
+*
+* Return: 0 on success, 1 on error.
+*/
+int variable_assignWord(CommandInfo *information, char *word)
+{
+	StringBuilder value = {NULL, 0, 0};
+	size_t size = str_length(word), length = variable_nameLength(word, size);
+	size_t subscript = array_subscript(word + length, size - length);
+	char *text = word + length + subscript;
+	int append = *text == '+', failed;
+	ShellVariable *variable;
+	const char *old;
+
+	text += append + 1;
+	size = str_length(text);
+	if (!subscript && *text == '(' && syntax_skip(text, 0, size) == size - 1)
+		return (array_compound(information, word, length, text, append));
+	old = append && !subscript ? variable_get(information, word, length) :
+		  NULL;
+	if (old)
+		builder_append(&value, old, str_length((char *)old));
+	expand_text(information, &value, text, size);
+	if (builder_reserve(&value, 0) == -1 || information->expansion_error)
+		return (free(value.data), 1);
+	if (subscript)
+	{
+		variable = variable_insert(information, word, length);
+		failed = !variable || array_assign(information, variable,
+										   word + length + 1, subscript - 2,
+										   value.data, append);
+	}
+	else
+		failed = variable_set(information, word, length, value.data);
+	free(value.data);
+	return (failed);
+}
+
+/**
+* variable_assign - function runs a command made only of assignments.
+*
+* Every word is expanded just before it is assigned, so it sees the
+* assignments before it. The status is the one of the last command
+* substitution, 0 if there was none, and 1 if an assignment failed.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 1 if the command was one, 0 otherwise.
+*/
+int variable_assign(CommandInfo *information)
+{
+	unsigned long substitutions = shell_counters[COUNTER_SUBSTITUTIONS];
+	int i, failed = 0;
+
+	if (!information->assignments ||
+		information->assignments != information->argument_count)
+		return (0);
+	information->expansion_error = 0;
+	for (i = 0; i < information->argument_count; i++)
+	{
+		failed |= variable_assignWord(information,
+									  information->arguments_array[i]);
+		if (information->expansion_error)
+			return (1);
+	}
+	if (failed)
+		information->execution_status = 1;
+	else if (substitutions == shell_counters[COUNTER_SUBSTITUTIONS])
+		information->execution_status = 0;
+	return (1);
+}
@@ -0,0 +1,156 @@
+#include "shell.h"
+
+/**
+* variable_hash - function hashes a variable name or an array key (FNV-1a).
+*
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: The hash.
+*/
+unsigned long variable_hash(const char *name, size_t length)
+{
+	unsigned long hash = 2166136261UL;
+	size_t i;
+
+	for (i = 0; i < length; i++)
+		hash = (hash ^ (unsigned char)name[i]) * 16777619UL;
+	return (hash);
+}
+
+/**
+* variable_grow - function doubles the number of buckets of the table.
+*
+* @table: The table.
+*
+* Return: 0 on success, -1 if memory allocation fails.
+*/
+static int variable_grow(VariableTable *table)
+{
+	size_t size = table->size ? table->size * 2 : VARIABLE_BUCKETS, i;
+	ShellVariable **buckets = malloc(sizeof(ShellVariable *) * size);
+	ShellVariable *variable, *next;
+
+	if (!buckets)
+		return (-1);
+	fillMemoryBlock((char *)buckets, 0, sizeof(ShellVariable *) * size);
+	for (i = 0; i < table->size; i++)
+		for (variable = table->buckets[i]; variable; variable = next)
+		{
+			next = variable->next;
+			variable->next = buckets[variable->hash & (size - 1)];
+			buckets[variable->hash & (size - 1)] = variable;
+		}
+	free(table->buckets);
+	table->buckets = buckets;
+	table->size = size;
+	return (0);
+}
+
+/**
+* variable_find - function looks up a shell variable.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: The variable, or NULL if the table does not hold it.
+*/
+ShellVariable *variable_find(CommandInfo *information, const char *name,
+							 size_t length)
+{
+	VariableTable *table = information->variables;
+	ShellVariable *variable;
+	unsigned long hash;
+
+	if (!table || !table->count)
+		return (NULL);
+	hash = variable_hash(name, length);
+	for (variable = table->buckets[hash & (table->size - 1)]; variable;
+		 variable = variable->next)
+		if (variable->hash == hash && variable->length == length &&
+			!mem_compare(variable->name, name, length))
+			return (variable);
+	return (NULL);
+}
+
+/**
+* variable_insert - function finds a shell variable, adding it unset with
+* no attributes if the table does not hold it.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*
+* Return: The variable, or NULL if memory allocation fails.
+*/
+ShellVariable *variable_insert(CommandInfo *information, const char *name,
+							   size_t length)
+{
+	VariableTable *table = information->variables;
+	ShellVariable *variable = variable_find(information, name, length);
+	size_t bucket;
+
+	if (variable)
+		return (variable);
+	if (!table)
+	{
+		table = malloc(sizeof(VariableTable));
+		if (!table)
+			return (NULL);
+		fillMemoryBlock((char *)table, 0, sizeof(VariableTable));
+		information->variables = table;
+	}
+	if (table->count >= table->size && variable_grow(table) == -1)
+		return (NULL);
+	variable = malloc(sizeof(ShellVariable));
+	if (!variable)
+		return (NULL);
+	fillMemoryBlock((char *)variable, 0, sizeof(ShellVariable));
+	variable->name = malloc(length + 1);
+	if (!variable->name)
+		return (free(variable), NULL);
+	str_n_copy(variable->name, (char *)name, length + 1);
+	variable->length = length;
+	variable->hash = variable_hash(name, length);
+	bucket = variable->hash & (table->size - 1);
+	variable->next = table->buckets[bucket];
+	table->buckets[bucket] = variable;
+	table->count++;
+	return (variable);
+}
+
+/**
+* variable_remove - function deletes a shell variable from the table.
+*
+* @information: Pointer to the command information structure.
+* @name: The name, not NUL terminated.
+* @length: Length of the name.
+*/
+void variable_remove(CommandInfo *information, const char *name,
+					 size_t length)
+{
+	VariableTable *table = information->variables;
+	ShellVariable **link, *variable;
+	unsigned long hash;
+
+	if (!table || !table->count)
+		return;
+	hash = variable_hash(name, length);
+	for (link = &table->buckets[hash & (table->size - 1)]; *link;
+		 link = &(*link)->next)
+	{
+		variable = *link;
+		if (variable->hash == hash && variable->length == length &&
+			!mem_compare(variable->name, name, length))
+		{
+			*link = variable->next;
+			array_clear(variable);
+			free(variable->name);
+			free(variable->value);
+			free(variable);
+			table->count--;
+			return;
+		}
+	}
+}
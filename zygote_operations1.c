@@ -0,0 +1,186 @@
+#include "shell.h"
+
+/**
+* zygote_receive - function reads one launch request and the descriptors
+* sent along.
+*
+* @socket: The zygote end of the socket pair.
+* @length: Receives the length of the request.
+* @fds: Receives the descriptors, at most ZYGOTE_FDS.
+* @count: Receives the number of descriptors.
+*
+* Return: The request, NUL terminated, or NULL once the shell is gone.
+*/
+static char *zygote_receive(int socket, ssize_t *length, int *fds, int *count)
+{
+	union
+	{
+		struct cmsghdr align;
+		char space[CMSG_SPACE(sizeof(int) * ZYGOTE_FDS)];
+	} control;
+	struct msghdr message;
+	struct cmsghdr *header;
+	struct iovec part;
+	char *request;
+
+	*count = 0;
+	*length = recv(socket, NULL, 0, MSG_PEEK | MSG_TRUNC);
+	request = *length > 0 ? malloc(*length + 1) : NULL;
+	if (!request)
+		return (NULL);
+	fillMemoryBlock((void *)&message, 0, sizeof(message));
+	part.iov_base = request, part.iov_len = *length;
+	message.msg_iov = &part, message.msg_iovlen = 1;
+	message.msg_control = control.space;
+	message.msg_controllen = sizeof(control.space);
+	*length = recvmsg(socket, &message, MSG_CMSG_CLOEXEC);
+	if (*length <= 0)
+		return (free(request), NULL);
+	request[*length] = '\0';
+	for (header = CMSG_FIRSTHDR(&message); header;
+		 header = CMSG_NXTHDR(&message, header))
+		if (header->cmsg_level == SOL_SOCKET &&
+			header->cmsg_type == SCM_RIGHTS)
+		{
+			*count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+			mem_copy(fds, CMSG_DATA(header), *count * sizeof(int));
+		}
+	return (request);
+}
+
+/**
+* zygote_vector - function splits a request into the strings it holds.
+*
+* @header: Receives the start of the request.
+* @request: The request, NUL terminated.
+* @length: Length of the request.
+*
+* Return: The working directory, the path, the arguments then the
+* environment, each list NULL ended, or NULL for a malformed request.
+*/
+static char **zygote_vector(ZygoteHeader *header, char *request,
+							ssize_t length)
+{
+	char **vector, *text = request + sizeof(*header);
+	int i, total;
+
+	if (length < (ssize_t)sizeof(*header))
+		return (NULL);
+	mem_copy(header, request, sizeof(*header));
+	if (header->arguments < 1 || header->variables < 0 ||
+		header->arguments + header->variables >= length)
+		return (NULL);
+	total = header->arguments + header->variables + 4;
+	vector = malloc(sizeof(char *) * total);
+	for (i = 0; vector && i < total; i++)
+	{
+		if (i == header->arguments + 2 || i == total - 1)
+			vector[i] = NULL;
+		else if (text >= request + length)
+			return (free(vector), NULL);
+		else
+			vector[i] = text, text += str_length(text) + 1;
+	}
+	return (vector);
+}
+
+/**
+* zygote_child - function sets up a child of the zygote as the shell would
+* have and runs the command. It never returns.
+*
+* @header: The request.
+* @fds: The descriptors received, close-on-exec.
+* @count: Number of descriptors received.
+* @vector: The strings of the request.
+* @errors: Pipe receiving errno if execve fails.
+*/
+static void zygote_child(ZygoteHeader *header, int *fds, int count,
+						 char **vector, int errors)
+{
+	int i, k, moved;
+
+	/* Out of the way of the numbers the command gets them under first */
+	for (k = -1; k < count; k++)
+	{
+		i = k == -1 ? errors : fds[k];
+		moved = i < ZYGOTE_FDS ? fcntl(i, F_DUPFD_CLOEXEC, ZYGOTE_FDS) : i;
+		if (moved != i)
+			close(i);
+		*(k == -1 ? &errors : &fds[k]) = moved;
+	}
+	for (i = 0, k = 0; i < ZYGOTE_FDS; i++)
+		if (header->passed[i] && k < count)
+			dup2(fds[k++], i);
+		else
+			close(i);
+	signal(SIGINT, SIG_DFL);
+	signal(SIGQUIT, SIG_DFL);
+	if (chdir(vector[0]) == 0)
+		execve(vector[1], vector + 2, vector + header->arguments + 3);
+	i = errno;
+	if (write(errors, &i, sizeof(i)) == -1)
+		_exit(127);
+	_exit(127);
+}
+
+/**
+* zygote_spawn - function starts the command of a request and answers once
+* it is over.
+*
+* @socket: The zygote end of the socket pair.
+* @request: The request.
+* @length: Length of the request.
+* @fds: The descriptors received.
+* @count: Number of descriptors.
+*/
+static void zygote_spawn(int socket, char *request, ssize_t length, int *fds,
+						 int count)
+{
+	ZygoteReply reply;
+	ZygoteHeader header;
+	char **vector = zygote_vector(&header, request, length);
+	int errors[2] = {-1, -1}, i;
+
+	fillMemoryBlock((void *)&reply, 0, sizeof(reply));
+	reply.pid = -1;
+	if (vector && pipe2(errors, O_CLOEXEC) == 0)
+		reply.pid = fork();
+	if (reply.pid == 0)
+		zygote_child(&header, fds, count, vector, errors[1]);
+	for (i = 0; i < count; i++)
+		close(fds[i]);
+	close(errors[1]);
+	if (reply.pid == -1 || read(errors[0], &reply.error, sizeof(int)) !=
+		sizeof(int))
+		reply.error = 0;
+	close(errors[0]);
+	if (reply.pid != -1)
+		wait4(reply.pid, &reply.status, 0, &reply.usage);
+	send(socket, &reply, sizeof(reply), MSG_NOSIGNAL);
+	free(vector);
+}
+
+/**
+* zygote_serve - function is the loop of the zygote, a child forked while
+* the shell is still small, so forking it stays cheap whatever the shell
+* grows to. It never returns.
+*
+* Interrupts are for the command in the foreground, not for the zygote.
+*
+* @socket: The zygote end of the socket pair.
+*/
+void zygote_serve(int socket)
+{
+	int fds[ZYGOTE_FDS], count;
+	ssize_t length;
+	char *request;
+
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	while ((request = zygote_receive(socket, &length, fds, &count)))
+	{
+		zygote_spawn(socket, request, length, fds, count);
+		free(request);
+	}
+	_exit(0);
+}
@@ -0,0 +1,183 @@
+#include "shell.h"
+
+static int zygote_socket = -1;
+static pid_t zygote_owner;
+
+/**
+* zygote_stop - function stops using the zygote, which exits once its end
+* of the socket pair is closed.
+*/
+static void zygote_stop(void)
+{
+	descriptor_release(&zygote_socket);
+	close(zygote_socket);
+	zygote_socket = -1;
+}
+
+/**
+* zygote_pack - function writes the launch request of the command found.
+*
+* The descriptors below ZYGOTE_FDS that are open are sent along, so the
+* command starts with those of the shell, not those of the zygote. One
+* exec opened at ZYGOTE_FDS or above, or a working directory with no path
+* the zygote could change to, has the command forked instead.
+*
+* @information: Pointer to the command information structure.
+* @request: Receives the request.
+* @fds: Receives the descriptors to send.
+*
+* Return: Number of descriptors to send, -1 on failure.
+*/
+static int zygote_pack(CommandInfo *information, StringBuilder *request,
+					   int *fds)
+{
+	char **envp, **word;
+	char directory[PATH_MAX];
+	ZygoteHeader header;
+	int count = 0, failed, i;
+
+	for (i = ZYGOTE_FDS; i <= information->descriptor_high; i++)
+		if (fcntl(i, F_GETFD) != -1 && !descriptor_isShell(i))
+			return (-1);
+	if (!getcwd(directory, sizeof(directory)))
+		return (-1);
+	fillMemoryBlock((void *)&header, 0, sizeof(header));
+	for (i = 0; i < ZYGOTE_FDS; i++)
+		if (fcntl(i, F_GETFD) != -1 && !descriptor_isShell(i))
+			header.passed[i] = 1, fds[count++] = i;
+	envp = overlay_environment(information);
+	for (word = information->arguments_array; *word; word++)
+		header.arguments++;
+	for (word = envp; word && *word; word++)
+		header.variables++;
+	failed = builder_append(request, (char *)&header, sizeof(header));
+	failed |= builder_append(request, directory, str_length(directory) + 1);
+	failed |= builder_append(request, information->executable_path,
+							 str_length(information->executable_path) + 1);
+	for (word = information->arguments_array; *word; word++)
+		failed |= builder_append(request, *word, str_length(*word) + 1);
+	for (word = envp; word && *word; word++)
+		failed |= builder_append(request, *word, str_length(*word) + 1);
+	if (envp != getEnvironmentVariables(information))
+		free(envp);
+	return (failed ? -1 : count);
+}
+
+/**
+* zygote_start - function forks the zygote if the HSH_ZYGOTE variable is
+* set, while the shell is still small.
+*
+* @information: Pointer to the command information structure.
+*/
+void zygote_start(CommandInfo *information)
+{
+	int pair[2];
+	pid_t child;
+
+	if (!getEnvironmentVariable(information, "HSH_ZYGOTE=") ||
+		socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, pair) == -1)
+		return;
+	child = fork();
+	shell_counters[COUNTER_FORKS]++;
+	if (child == 0)
+	{
+		close(pair[0]);
+		zygote_serve(pair[1]);
+	}
+	close(pair[1]);
+	if (child == -1)
+	{
+		close(pair[0]);
+		return;
+	}
+	zygote_socket = pair[0];
+	zygote_owner = getpid();
+	descriptor_keep(&zygote_socket);
+}
+
+/**
+* zygote_send - function sends a launch request with its descriptors.
+*
+* @request: The request.
+* @fds: The descriptors.
+* @count: Number of descriptors.
+*
+* Return: 0 on success, -1 on failure.
+*/
+static int zygote_send(StringBuilder *request, int *fds, int count)
+{
+	union
+	{
+		struct cmsghdr align;
+		char space[CMSG_SPACE(sizeof(int) * ZYGOTE_FDS)];
+	} control;
+	struct msghdr message;
+	struct cmsghdr *header;
+	struct iovec part;
+
+	fillMemoryBlock((void *)&message, 0, sizeof(message));
+	part.iov_base = request->data, part.iov_len = request->length;
+	message.msg_iov = &part, message.msg_iovlen = 1;
+	if (count)
+	{
+		message.msg_control = control.space;
+		message.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+		header = CMSG_FIRSTHDR(&message);
+		header->cmsg_level = SOL_SOCKET;
+		header->cmsg_type = SCM_RIGHTS;
+		header->cmsg_len = CMSG_LEN(sizeof(int) * count);
+		mem_copy(CMSG_DATA(header), fds, sizeof(int) * count);
+	}
+	print_char(BUFFER_F);
+	if (sendmsg(zygote_socket, &message, MSG_NOSIGNAL) ==
+		(ssize_t)request->length)
+		return (0);
+	if (errno != EMSGSIZE)
+		zygote_stop();
+	return (-1);
+}
+
+/**
+* zygote_launch - function has the zygote run the command found, in place
+* of forking the shell.
+*
+* A script execve refuses is left to the shell, which reads it itself.
+*
+* @information: Pointer to the command information structure.
+*
+* Return: 0 once the command ran, -1 to fork it instead.
+*/
+int zygote_launch(CommandInfo *information)
+{
+	StringBuilder request = {NULL, 0, 0};
+	ZygoteReply reply;
+	int fds[ZYGOTE_FDS], count;
+
+	if (zygote_socket == -1 || zygote_owner != getpid())
+		return (-1);
+	count = zygote_pack(information, &request, fds);
+	if (count == -1 || zygote_send(&request, fds, count) == -1)
+		return (free(request.data), -1);
+	free(request.data);
+	if (recv(zygote_socket, &reply, sizeof(reply), 0) != sizeof(reply))
+	{
+		zygote_stop();
+		information->execution_status = 1;
+		return (0);
+	}
+	if (reply.pid == -1 || reply.error == ENOEXEC)
+		return (-1);
+	shell_counters[COUNTER_ZYGOTE]++;
+	time_addUsage(information, &reply.usage);
+	if (reply.error == EACCES)
+	{
+		information->execution_status = 126;
+		printErrorMessage(information, "Permission denied\n");
+	}
+	else if (reply.error)
+		information->execution_status = 1;
+	else
+		information->execution_status = WIFEXITED(reply.status) ?
+			WEXITSTATUS(reply.status) : reply.status;
+	return (0);
+}